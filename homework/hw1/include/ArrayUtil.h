@@ -0,0 +1,172 @@
+#ifndef ARRAY_UTIL_H
+#define ARRAY_UTIL_H
+
+/*
+    Utilitare pentru pregatirea si verificarea vectorilor in masuratori (header-only), folosite de temele 1, 2 si 3.
+
+    bulkCopy(dest, src, n) inlocuieste buclele de copiere element cu element. Pentru vectori de cel putin BULK_STREAM_BYTES octeti,
+    scrierile sunt non-temporale (_mm_stream_si128, dupa alinierea destinatiei la 16 octeti): datele nu trec prin cache, deci copierea
+    nu evacueaza vectorul sursa si nu plateste citirea liniilor destinatie inainte de scriere. Sub prag (vectorul incape in cache si
+    urmeaza sa fie sortat imediat) sau fara SSE2 se foloseste memcpy.
+
+    arraySorted(a, n) verifica ordinea crescatoare comparand cate 4 perechi vecine (a[i - 1], a[i]) intr-un registru SSE2 si oprindu-se la
+    primul bloc de 16 elemente care contine o inversiune. analyzeRuns(a, n, &info, runLength, maxRuns) parcurge tot vectorul la fel si
+    intoarce structura pe secvente crescatoare: numarul de secvente (numarul de coborari + 1), lungimea celei mai lungi, pozitia primei
+    coborari si, optional, lungimile primelor maxRuns secvente. Numarul de inversiuni este estimat din RUN_SAMPLE_SIZE elemente
+    echidistante: inversiunile din esantion (O(s^2)) sunt scalate cu n(n - 1) / (s(s - 1)), deci costul nu depinde de n.
+    checkSorted(name, a, n) apeleaza arraySorted si, daca vectorul nu este sortat, afiseaza rezumatul analyzeRuns; se apeleaza dupa
+    stopTimer, ca verificarea sa nu intre in timpi.
+*/
+
+#include <cstdio>
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ARRAY_UTIL_SSE2
+#endif
+
+#define BULK_STREAM_BYTES (4 << 20)
+#define RUN_SAMPLE_SIZE 256
+
+struct RunInfo {
+    int runs;
+    int longestRun;
+    int firstDescent;
+    long long inversionEstimate;
+};
+
+template <typename T>
+void bulkCopy(T dest[], const T src[], int n) {
+    size_t bytes = (size_t)n * sizeof(T);
+#ifdef ARRAY_UTIL_SSE2
+    if (bytes >= BULK_STREAM_BYTES) {
+        char* d = (char*)dest;
+        const char* s = (const char*)src;
+        size_t head = (16 - ((size_t)d & 15)) & 15;
+        memcpy(d, s, head);
+        size_t i = head;
+        for (; i + 64 <= bytes; i += 64) {
+            __m128i x0 = _mm_loadu_si128((const __m128i*)(s + i));
+            __m128i x1 = _mm_loadu_si128((const __m128i*)(s + i + 16));
+            __m128i x2 = _mm_loadu_si128((const __m128i*)(s + i + 32));
+            __m128i x3 = _mm_loadu_si128((const __m128i*)(s + i + 48));
+            _mm_stream_si128((__m128i*)(d + i), x0);
+            _mm_stream_si128((__m128i*)(d + i + 16), x1);
+            _mm_stream_si128((__m128i*)(d + i + 32), x2);
+            _mm_stream_si128((__m128i*)(d + i + 48), x3);
+        }
+        _mm_sfence();
+        memcpy(d + i, s + i, bytes - i);
+        return;
+    }
+#endif
+    memcpy(dest, src, bytes);
+}
+
+inline int descentMask(const int a[], int i) {
+#ifdef ARRAY_UTIL_SSE2
+    __m128i previous = _mm_loadu_si128((const __m128i*)(a + i - 1));
+    __m128i current = _mm_loadu_si128((const __m128i*)(a + i));
+    return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(previous, current)));
+#else
+    int mask = 0;
+    for (int j = 0; j < 4; j++) {
+        mask |= (a[i + j] < a[i + j - 1]) << j;
+    }
+    return mask;
+#endif
+}
+
+inline bool arraySorted(const int a[], int n) {
+    int i = 1;
+    for (; i + 16 <= n; i += 16) {
+        if (descentMask(a, i) | descentMask(a, i + 4) | descentMask(a, i + 8) | descentMask(a, i + 12)) {
+            return false;
+        }
+    }
+    for (; i < n; i++) {
+        if (a[i] < a[i - 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline long long estimateInversions(const int a[], int n) {
+    if (n < 2) {
+        return 0;
+    }
+    int s = n < RUN_SAMPLE_SIZE ? n : RUN_SAMPLE_SIZE;
+    int sample[RUN_SAMPLE_SIZE];
+    for (int i = 0; i < s; i++) {
+        sample[i] = a[(int)((long long)i * n / s)];
+    }
+    long long inversions = 0;
+    for (int i = 0; i < s; i++) {
+        for (int j = i + 1; j < s; j++) {
+            inversions += sample[j] < sample[i];
+        }
+    }
+    if (s == n) {
+        return inversions;
+    }
+    return (long long)((double)inversions * ((double)n * (n - 1)) / ((double)s * (s - 1)));
+}
+
+inline void addRun(RunInfo* info, int length, int runLength[], int maxRuns) {
+    if (info->runs < maxRuns) {
+        runLength[info->runs] = length;
+    }
+    info->runs++;
+    if (length > info->longestRun) {
+        info->longestRun = length;
+    }
+}
+
+inline void analyzeRuns(const int a[], int n, RunInfo* info, int runLength[] = NULL, int maxRuns = 0) {
+    info->runs = 0;
+    info->longestRun = 0;
+    info->firstDescent = -1;
+    info->inversionEstimate = estimateInversions(a, n);
+    if (n == 0) {
+        return;
+    }
+
+    int runStart = 0;
+    int i = 1;
+    for (; i + 4 <= n; i += 4) {
+        int mask = descentMask(a, i);
+        for (int j = 0; mask != 0; j++, mask >>= 1) {
+            if (mask & 1) {
+                if (info->firstDescent < 0) {
+                    info->firstDescent = i + j;
+                }
+                addRun(info, i + j - runStart, runLength, maxRuns);
+                runStart = i + j;
+            }
+        }
+    }
+    for (; i < n; i++) {
+        if (a[i] < a[i - 1]) {
+            if (info->firstDescent < 0) {
+                info->firstDescent = i;
+            }
+            addRun(info, i - runStart, runLength, maxRuns);
+            runStart = i;
+        }
+    }
+    addRun(info, n - runStart, runLength, maxRuns);
+}
+
+inline bool checkSorted(const char* name, const int a[], int n) {
+    if (arraySorted(a, n)) {
+        return true;
+    }
+    RunInfo info;
+    analyzeRuns(a, n, &info);
+    printf("%s: n = %d is not sorted (%d runs, longest run %d, first descent at %d, ~%lld inversions)\n", name, n, info.runs,
+        info.longestRun, info.firstDescent, info.inversionEstimate);
+    return false;
+}
+
+#endif
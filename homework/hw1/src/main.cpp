@@ -1,6 +1,9 @@
 /*
     Stet Vasile Alexandru, Grupa 10
     am implementat algoritmii de sortare bubble sort, selection sort, insertion sort, si insertion sort folosind insertie binara (v2)
+    am adaugat si insertion sort (v3): cautarea binara este fara salturi (pozitia se actualizeaza aritmetic, compilat ca cmov), iar
+    elementele se deplaseaza in bloc cu memmove in loc de o atribuire pe rand; daca elementul este deja la locul lui se face o singura comparatie
+    v3 face aceleasi atribuiri ca v2 si aproximativ aceleasi comparatii, dar este mai rapid ca timp (vezi insertion_v2-time vs insertion_v3-time)
     am observat ca pe average case, cel mai buni algoritm este insertion sort (v2), urmat de selection sort, care este marginal mai eficient
     decat insertion sort (sunt aproximativ egale), si in final bubble sort
     pe best case, bubble sort este cel mai bun, apoi insertion sort, apoi insertion sort (v2), si in final selection sort
@@ -8,14 +11,22 @@
     cu toate acestea, toti algoritmii au complexitatea O(n^2) in average si worst case
     pe best case, bubble sort are complexitatea O(n), insertion sort are complexitatea O(n), insertion sort (v2) are complexitatea O(n log n),
     iar selection sort ramane O(n^2)
+    vectorii de test sunt copiati din sursa cu bulkCopy (ArrayUtil.h) in loc de bucle element cu element, iar rezultatele din perf sunt
+    verificate cu checkSorted (ArrayUtil.h), in afara cronometrelor
+    in fiecare caz (average, best, worst), timpii insertion sort (v2, v3) sunt comparati si cu std::sort, std::stable_sort si
+    std::make_heap + std::sort_heap (Baselines.h), pe aceleasi intrari, ca referinta absoluta
 */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "Profiler.h"
+#include "ArrayUtil.h"
+#include "Baselines.h"
 
 #define MAX_SIZE 10000
 #define STEP_SIZE 100
+#define NR_TESTS 10
 
 int m = 5;
 
@@ -118,17 +129,47 @@ void insertionSort_v2(int a[], int n) {
     }
 }
 
+void insertionSort_v3(int a[], int n) {
+
+    Operation opCompare = p.createOperation("insertion_v3-comparisons", n);
+    Operation opAssign = p.createOperation("insertion_v3-assignments", n);
+
+    for (int i = 1; i < n; i++) {
+        opCompare.count();
+        if (a[i - 1] <= a[i]) {
+            continue;
+        }
+        opAssign.count();
+        int key = a[i];
+        int left = 0;
+        int len = i - 1;
+        while (len > 1) {
+            int half = len / 2;
+            opCompare.count();
+            left += (a[left + half] <= key) * half;
+            len -= half;
+        }
+        if (len == 1) {
+            opCompare.count();
+            left += (a[left] <= key);
+        }
+        opAssign.count(i - left);
+        memmove(a + left + 1, a + left, (i - left) * sizeof(int));
+        opAssign.count();
+        a[left] = key;
+    }
+}
+
 void demo() {
     int a[] = {64, 34, 25, 12, 22, 11, 90};
     int n = sizeof(a)/sizeof(a[0]);
-    int bubbleArr[n], selectionArr[n], insertionArr[n], insertionArr_v2[n];
+    int bubbleArr[n], selectionArr[n], insertionArr[n], insertionArr_v2[n], insertionArr_v3[n];
 
-    for (int i=0; i < n; i++) {
-        bubbleArr[i] = a[i];
-        selectionArr[i] = a[i];
-        insertionArr[i] = a[i];
-        insertionArr_v2[i] = a[i];
-    }
+    bulkCopy(bubbleArr, a, n);
+    bulkCopy(selectionArr, a, n);
+    bulkCopy(insertionArr, a, n);
+    bulkCopy(insertionArr_v2, a, n);
+    bulkCopy(insertionArr_v3, a, n);
     
     bubbleSort(bubbleArr, n);
     for (int i=0; i < n; i++)
@@ -146,6 +187,10 @@ void demo() {
     for (int i=0; i < n; i++)
         printf("%d ", insertionArr_v2[i]);
     printf("\n");
+    insertionSort_v3(insertionArr_v3, n);
+    for (int i=0; i < n; i++)
+        printf("%d ", insertionArr_v3[i]);
+    printf("\n");
 }
 
 void perf(int order) {
@@ -159,13 +204,13 @@ void perf(int order) {
             int* selectionArr = new int[n];
             int* insertionArr = new int[n];
             int* insertionArr_v2 = new int[n];
+            int* insertionArr_v3 = new int[n];
 
-            for (int j = 0; j < n; j++) {
-                bubbleArr[j] = a[j];
-                selectionArr[j] = a[j];
-                insertionArr[j] = a[j];
-                insertionArr_v2[j] = a[j];
-            }
+            bulkCopy(bubbleArr, a, n);
+            bulkCopy(selectionArr, a, n);
+            bulkCopy(insertionArr, a, n);
+            bulkCopy(insertionArr_v2, a, n);
+            bulkCopy(insertionArr_v3, a, n);
 
             if (order == DESCENDING) {
                 int temp = selectionArr[0];
@@ -177,13 +222,44 @@ void perf(int order) {
             selectionSort(selectionArr, n);
             insertionSort(insertionArr, n);
             insertionSort_v2(insertionArr_v2, n);
+            insertionSort_v3(insertionArr_v3, n);
+
+            checkSorted("bubble", bubbleArr, n);
+            checkSorted("selection", selectionArr, n);
+            checkSorted("insertion", insertionArr, n);
+            checkSorted("insertion_v2", insertionArr_v2, n);
+            checkSorted("insertion_v3", insertionArr_v3, n);
 
             delete[] bubbleArr;
             delete[] selectionArr;
             delete[] insertionArr;
             delete[] insertionArr_v2;
+            delete[] insertionArr_v3;
+        }
+
+        int* insertionArrTime = new int[n];
+
+        p.startTimer("insertion_v2-time", n);
+        for (int i = 0; i < NR_TESTS; i++) {
+            bulkCopy(insertionArrTime, a, n);
+            insertionSort_v2(insertionArrTime, n);
+        }
+        p.stopTimer("insertion_v2-time", n);
+        checkSorted("insertion_v2-time", insertionArrTime, n);
+
+        p.startTimer("insertion_v3-time", n);
+        for (int i = 0; i < NR_TESTS; i++) {
+            bulkCopy(insertionArrTime, a, n);
+            insertionSort_v3(insertionArrTime, n);
         }
+        p.stopTimer("insertion_v3-time", n);
+        checkSorted("insertion_v3-time", insertionArrTime, n);
+
+        timeStdBaselines(p, "time", a, insertionArrTime, n, NR_TESTS);
+
+        delete[] insertionArrTime;
     }
+    delete[] a;
 
     p.divideValues("bubble-comparisons", m);
     p.divideValues("bubble-assignments", m);
@@ -201,6 +277,10 @@ void perf(int order) {
     p.divideValues("insertion_v2-assignments", m);
     p.addSeries("insertion_v2-total", "insertion_v2-comparisons", "insertion_v2-assignments");
 
+    p.divideValues("insertion_v3-comparisons", m);
+    p.divideValues("insertion_v3-assignments", m);
+    p.addSeries("insertion_v3-total", "insertion_v3-comparisons", "insertion_v3-assignments");
+
     if (order == UNSORTED) {
         p.createGroup("Linear and log-linear curves", "insertion_v2-comparisons", "selection-assignments");
     }
@@ -217,8 +297,13 @@ void perf(int order) {
     p.createGroup("Selection Sort", "selection-comparisons", "selection-assignments", "selection-total");
     p.createGroup("Insertion Sort", "insertion-comparisons", "insertion-assignments", "insertion-total");
     p.createGroup("Insertion_v2 Sort", "insertion_v2-comparisons", "insertion_v2-assignments", "insertion_v2-total");
+    p.createGroup("Insertion_v3 Sort", "insertion_v3-comparisons", "insertion_v3-assignments", "insertion_v3-total");
+
+    p.createGroup("All Sorts", "bubble-total", "selection-total", "insertion-total", "insertion_v2-total", "insertion_v3-total");
 
-    p.createGroup("All Sorts", "bubble-total", "selection-total", "insertion-total", "insertion_v2-total");
+    p.createGroup("Binary Insertion Times", "insertion_v2-time", "insertion_v3-time");
+    p.createGroup("Binary Insertion vs Standard Library Times", "insertion_v2-time", "insertion_v3-time",
+        STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
 }
 
 void perf_all() {
@@ -0,0 +1,70 @@
+#ifndef BASELINES_H
+#define BASELINES_H
+
+/*
+    Repere din biblioteca standard pentru rapoartele de timp (header-only), folosite de temele 1, 2 si 3.
+
+    timeStdBaselines(p, scale, src, work, n, repeats) masoara, pe aceeasi intrare `src` si aceeasi dimensiune n ca algoritmii din tema,
+    std::sort (introsort), std::stable_sort (merge sort adaptiv), std::make_heap + std::sort_heap (heapsort) si, daca este disponibil,
+    std::sort(std::execution::par). Fiecare sortare se repeta de `repeats` ori, cu copierea intrarii (bulkCopy) inclusa in cronometru, ca
+    in buclele de timp din teme, deci seriile se pot pune direct in acelasi grafic. Seriile se numesc "std-sort-<scale>",
+    "std-stable-sort-<scale>", "std-heap-sort-<scale>" si "std-par-sort-<scale>" (scale = "time" sau "large-time"); macro-urile
+    STD_*_SERIES construiesc aceleasi nume pentru createGroup.
+
+    std::execution::par necesita biblioteca TBB la GCC / Clang (libstdc++), deci varianta paralela se activeaza doar daca se compileaza cu
+    -DBASELINE_PARALLEL_STL (si -ltbb) sau cu MSVC, care o are inclusa. Altfel STD_PAR_SORT_SERIES este NULL, iar createGroup il ignora.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include "Profiler.h"
+#include "ArrayUtil.h"
+#if defined(BASELINE_PARALLEL_STL) || defined(_MSC_VER)
+#include <execution>
+#define STD_PAR_SORT_AVAILABLE
+#endif
+
+#define BASELINE_NAME_LENGTH 64
+
+#define STD_SORT_SERIES(scale) "std-sort-" scale
+#define STD_STABLE_SORT_SERIES(scale) "std-stable-sort-" scale
+#define STD_HEAP_SORT_SERIES(scale) "std-heap-sort-" scale
+#ifdef STD_PAR_SORT_AVAILABLE
+#define STD_PAR_SORT_SERIES(scale) "std-par-sort-" scale
+#else
+#define STD_PAR_SORT_SERIES(scale) NULL
+#endif
+
+template <typename T, typename SortFunction>
+void timeBaseline(Profiler& p, const char* algorithm, const char* scale, const T src[], T work[], int n, int repeats, SortFunction sortFunction) {
+    char series[BASELINE_NAME_LENGTH];
+    snprintf(series, sizeof(series), "%s-%s", algorithm, scale);
+
+    p.startTimer(series, n);
+    for (int i = 0; i < repeats; i++) {
+        bulkCopy(work, src, n);
+        sortFunction(work, work + n);
+    }
+    p.stopTimer(series, n);
+}
+
+template <typename T>
+void timeStdBaselines(Profiler& p, const char* scale, const T src[], T work[], int n, int repeats) {
+    timeBaseline(p, "std-sort", scale, src, work, n, repeats, [](T* first, T* last) {
+        std::sort(first, last);
+    });
+    timeBaseline(p, "std-stable-sort", scale, src, work, n, repeats, [](T* first, T* last) {
+        std::stable_sort(first, last);
+    });
+    timeBaseline(p, "std-heap-sort", scale, src, work, n, repeats, [](T* first, T* last) {
+        std::make_heap(first, last);
+        std::sort_heap(first, last);
+    });
+#ifdef STD_PAR_SORT_AVAILABLE
+    timeBaseline(p, "std-par-sort", scale, src, work, n, repeats, [](T* first, T* last) {
+        std::sort(std::execution::par, first, last);
+    });
+#endif
+}
+
+#endif
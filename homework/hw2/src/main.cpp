@@ -7,14 +7,70 @@
     Am observat ca Bubble Sort recursiv este usor mai lent decat cel iterativ din cauza overhead-ului apelurilor recursive;
     de asemenea, poate provoca stack overflow pentru dimensiuni mari (adancime recursivă O(n)).
     Complexitati: Bubble Sort - O(n^2) in mediu/rau, O(n) în cel mai bun caz; Heap Sort - O(n log n) in toate cazurile.    
+
+    Floyd Heap Sort (bottom-up): `maxHeapify` face 2 comparatii pe nivel si o interschimbare de 3 atribuiri. In varianta lui Floyd elementul
+    de plasat este scos din vector (ramane o "gaura"), gaura coboara pana la o frunza urmand mereu copilul mai mare (o comparatie si o
+    atribuire pe nivel), apoi elementul urca din frunza pana la pozitia lui (de obicei doar 1-2 niveluri, pentru ca la extragere elementul
+    mutat in radacina vine de la baza heap-ului). Ambele bucle sunt iterative. Numarul de comparatii la extragere scade de la ~2n log n la
+    ~n log n, iar atribuirile de la ~3n log n la ~n log n. Seriile floyd-heapify-* si floyd-heapsort-* sunt raportate langa heapsort-*.
+
+    Heap d-ar (Heap.h): DaryHeapSort foloseste un heap cu D = 4 sau 8 copii pe nod, asezati consecutiv (D * i + 1 .. D * i + D), deci
+    inaltimea este logD n in loc de log2 n si o cernere atinge mai putine linii de cache. Alegerea copilului costa D - 1 comparatii pe
+    nivel, asa ca numarul de comparatii nu scade (4-ar: ~1.85 n log2 n, 8-ar: ~2.5 n log2 n), dar atribuirile (cu gaura) scad la
+    ~0.7 n log2 n pentru D = 4, fata de ~3 n log2 n cu interschimbari.
+    Seriile heapsort-4-ary-* si heapsort-8-ary-* (constructie + extragere) sunt comparate cu heapsort-bottomup-total.
+
+    Constructie paralela (buildHeapParallel): nodurile de pe nivelul L (primul nivel cu cel putin SUBTREES_PER_THREAD * p noduri) sunt
+    radacinile unor subarbori disjuncti. Radacinile sunt impartite in blocuri contigue intre p fire; fiecare fir face heapify bottom-up
+    in subarborii lui (nivel cu nivel, de jos in sus, in interiorul fiecarui subarbore), fara sincronizare, pentru ca `maxHeapify` coboara
+    doar in subarborele nodului. Dupa join, nivelurile de deasupra lui L (mai putin de SUBTREES_PER_THREAD * p noduri) sunt facute
+    secvential. Heapify-ul unui nod depinde doar de subarborele lui, deci heap-ul rezultat si numarul de operatii sunt identice cu
+    buildHeapBottomUp; fiecare fir numara intr-un Profiler propriu, iar totalurile se aduna dupa join. In masuratorile de timp
+    (counting = false) contoarele firelor sunt oprite, ca si cele ale lui p cat timp ruleaza cronometrul. Dupa fiecare cronometru,
+    perfBuildHeap verifica proprietatea de max-heap (checkMaxHeap: a[parent(i)] >= a[i]). perfBuildHeap compara timpii cu
+    buildHeapBottomUp si buildHeapTopDown pentru 10^6 .. 10^7 elemente.
+
+    Odd-Even Transposition Sort: varianta paralela a Bubble Sort. Faza para compara perechile (0, 1), (2, 3), ..., faza impara perechile
+    (1, 2), (3, 4), ...; perechile unei faze sunt independente, deci compare-exchange-ul se face fara salturi (min / max) si, daca
+    procesorul are SSE4.1 (__builtin_cpu_supports, kernel compilat cu __attribute__((target("sse4.1")))), cate 4 perechi deodata
+    (deinterclasare, min / max, reinterclasare); altfel se foloseste bucla scalara. Perechile fiecarei faze sunt impartite in blocuri
+    contigue intre fire, care se sincronizeaza cu o bariera dupa fiecare faza (firele raman pornite pe toata sortarea). Se foloseste cate
+    un fir la cel putin ODD_EVEN_MIN_PAIRS perechi. Sortarea se opreste dupa doua faze consecutive fara interschimbari (ca `swapped` din Bubble Sort),
+    deci cazul favorabil ramane O(n). Fiecare interschimbare elimina exact o inversiune, ca la Bubble Sort, deci atribuirile numarate
+    (3 pe interschimbare) sunt aceleasi; comparatiile sunt n / 2 pe faza, cel mult n faze.
+
+    Vectorii de test sunt copiati din sursa cu bulkCopy (ArrayUtil.h): memcpy, cu scrieri non-temporale pentru vectorii mari din
+    perfBuildHeap. Rezultatele din perf sunt verificate cu checkSorted (ArrayUtil.h), dupa stopTimer.
+
+    Ca referinta absoluta, timpii Bubble Sort si ai variantelor de Heap Sort (heapsort-*-time, pe aceleasi cazuri ca numararea
+    operatiilor) sunt comparati cu std::sort, std::stable_sort si std::make_heap + std::sort_heap pe aceleasi intrari (Baselines.h),
+    iar perfBuildHeap masoara si std::make_heap langa heapify; cu -DBASELINE_PARALLEL_STL se adauga si std::sort(std::execution::par).
 */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <atomic>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define ODD_EVEN_SIMD_AVAILABLE
+#define ODD_EVEN_SIMD_TARGET __attribute__((target("sse4.1")))
+#endif
 #include "Profiler.h"
+#include "Heap.h"
+#include "ArrayUtil.h"
+#include "Baselines.h"
 
 #define MAX_SIZE 10000
 #define STEP_SIZE 100
+#define LARGE_MAX_SIZE 10000000
+#define LARGE_STEP_SIZE 1000000
+#define NR_LARGE_TESTS 3
+#define MAX_THREADS 64
+#define PARALLEL_CUTOFF 65536
+#define SUBTREES_PER_THREAD 4
+#define ODD_EVEN_MIN_PAIRS 2048
 
 int m = 5;
 int nr_tests = 5;
@@ -26,6 +82,12 @@ enum algorithm {
 
 Profiler p("HeapSort - Average Case");
 
+struct PhaseBarrier {
+    std::atomic<int> arrived;
+    std::atomic<int> generation;
+    int count;
+};
+
 void bubbleSort(int a[], int n) {
 
     Operation compare = p.createOperation("bubble-comparisons", n);
@@ -77,6 +139,151 @@ void recursiveBubbleSortWrapper(int a[], int n) {
     recursiveBubbleSort(a, n, compare, assign);
 }
 
+int threadCount() {
+    int nrThreads = (int)std::thread::hardware_concurrency();
+    if (nrThreads < 1) {
+        nrThreads = 1;
+    }
+    if (nrThreads > MAX_THREADS) {
+        nrThreads = MAX_THREADS;
+    }
+    return nrThreads;
+}
+
+void barrierWait(PhaseBarrier* barrier) {
+    int generation = barrier->generation.load(std::memory_order_acquire);
+    if (barrier->arrived.fetch_add(1, std::memory_order_acq_rel) + 1 == barrier->count) {
+        barrier->arrived.store(0, std::memory_order_relaxed);
+        barrier->generation.fetch_add(1, std::memory_order_acq_rel);
+    } else {
+        while (barrier->generation.load(std::memory_order_acquire) == generation) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+inline int compareExchangeTail(int a[], int first, int k, int nrPairs) {
+    int swaps = 0;
+    for (; k < nrPairs; k++) {
+        int i = first + 2 * k;
+        int x = a[i];
+        int y = a[i + 1];
+        swaps += x > y;
+        a[i] = x < y ? x : y;
+        a[i + 1] = x < y ? y : x;
+    }
+    return swaps;
+}
+
+#ifdef ODD_EVEN_SIMD_AVAILABLE
+bool oddEvenSimdSupported() {
+    static const bool supported = __builtin_cpu_supports("sse4.1");
+    return supported;
+}
+
+ODD_EVEN_SIMD_TARGET int compareExchangePairsVector(int a[], int first, int nrPairs) {
+    int swaps = 0;
+    int k = 0;
+    for (; k + 4 <= nrPairs; k += 4) {
+        int* block = a + first + 2 * k;
+        __m128 low = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)block));
+        __m128 high = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(block + 4)));
+        __m128i x = _mm_castps_si128(_mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128i y = _mm_castps_si128(_mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+        swaps += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x, y))));
+        __m128i smaller = _mm_min_epi32(x, y);
+        __m128i larger = _mm_max_epi32(x, y);
+        _mm_storeu_si128((__m128i*)block, _mm_unpacklo_epi32(smaller, larger));
+        _mm_storeu_si128((__m128i*)(block + 4), _mm_unpackhi_epi32(smaller, larger));
+    }
+    return swaps + compareExchangeTail(a, first, k, nrPairs);
+}
+#endif
+
+int compareExchangePairs(int a[], int first, int nrPairs) {
+#ifdef ODD_EVEN_SIMD_AVAILABLE
+    if (oddEvenSimdSupported()) {
+        return compareExchangePairsVector(a, first, nrPairs);
+    }
+#endif
+    return compareExchangeTail(a, first, 0, nrPairs);
+}
+
+void oddEvenPhases(int a[], int n, int thread, int nrThreads, int phaseSwaps[][MAX_THREADS], PhaseBarrier* barrier, long long* swaps, int* nrPhases) {
+    long long threadSwaps = 0;
+    bool previousSorted = false;
+    int phase;
+    for (phase = 0; phase < n; phase++) {
+        int parity = phase % 2;
+        int nrPairs = (n - parity) / 2;
+        int from = (int)((long long)nrPairs * thread / nrThreads);
+        int to = (int)((long long)nrPairs * (thread + 1) / nrThreads);
+
+        int phaseSwapsThread = compareExchangePairs(a, parity + 2 * from, to - from);
+        phaseSwaps[parity][thread] = phaseSwapsThread;
+        threadSwaps += phaseSwapsThread;
+        barrierWait(barrier);
+
+        bool sorted = true;
+        for (int t = 0; t < nrThreads; t++) {
+            if (phaseSwaps[parity][t] != 0) {
+                sorted = false;
+            }
+        }
+        if (sorted && previousSorted) {
+            phase++;
+            break;
+        }
+        previousSorted = sorted;
+    }
+    swaps[thread] = threadSwaps;
+    if (thread == 0) {
+        *nrPhases = phase;
+    }
+}
+
+void oddEvenSort(int a[], int n) {
+
+    Operation compare = p.createOperation("odd-even-comparisons", n);
+    Operation assign = p.createOperation("odd-even-assignments", n);
+
+    if (n < 2) {
+        return;
+    }
+
+    int nrThreads = threadCount();
+    if (nrThreads > n / 2 / ODD_EVEN_MIN_PAIRS) {
+        nrThreads = n / 2 / ODD_EVEN_MIN_PAIRS;
+    }
+    if (nrThreads < 1) {
+        nrThreads = 1;
+    }
+
+    int phaseSwaps[2][MAX_THREADS];
+    long long swaps[MAX_THREADS];
+    int nrPhases = 0;
+    PhaseBarrier barrier;
+    barrier.arrived.store(0);
+    barrier.generation.store(0);
+    barrier.count = nrThreads;
+
+    std::thread workers[MAX_THREADS];
+    for (int t = 1; t < nrThreads; t++) {
+        workers[t] = std::thread(oddEvenPhases, a, n, t, nrThreads, phaseSwaps, &barrier, swaps, &nrPhases);
+    }
+    oddEvenPhases(a, n, 0, nrThreads, phaseSwaps, &barrier, swaps, &nrPhases);
+    for (int t = 1; t < nrThreads; t++) {
+        workers[t].join();
+    }
+
+    for (int phase = 0; phase < nrPhases; phase++) {
+        compare.count((n - phase % 2) / 2);
+    }
+    for (int t = 0; t < nrThreads; t++) {
+        assign.count(3 * (int)swaps[t]);
+    }
+}
+
 int parent(int i) {
     return (i - 1) / 2;
 }
@@ -89,6 +296,16 @@ int right(int i) {
     return 2 * i + 2;
 }
 
+bool checkMaxHeap(const char* name, const int a[], int n) {
+    for (int i = 1; i < n; i++) {
+        if (a[parent(i)] < a[i]) {
+            printf("%s: n = %d is not a max-heap (a[%d] < a[%d])\n", name, n, parent(i), i);
+            return false;
+        }
+    }
+    return true;
+}
+
 void maxHeapify(int a[], int n, int i, Operation compare, Operation assign) {
     
     int largest = i;
@@ -151,6 +368,144 @@ void buildHeapTopDown(int a[], int n) {
     }
 }
 
+void heapifySubtrees(int a[], int n, int firstRoot, int lastRoot, bool counting, unsigned int* comparisons, unsigned int* assignments) {
+    Profiler threadProfiler;
+    Operation compare = threadProfiler.createOperation("subtree-comparisons", n);
+    Operation assign = threadProfiler.createOperation("subtree-assignments", n);
+    if (!counting) {
+        // contoarele unui Profiler sunt oprite cat timp ruleaza un cronometru al lui
+        threadProfiler.startTimer("subtree-time", n);
+    }
+
+    int lastInternal = n / 2 - 1;
+    for (int root = firstRoot; root < lastRoot; root++) {
+        int depth = 0;
+        int leftmost = root;
+        while (leftmost <= (lastInternal - 1) / 2) {
+            leftmost = left(leftmost);
+            depth++;
+        }
+        for (int d = depth; d >= 0; d--) {
+            long long start = ((long long)(root + 1) << d) - 1;
+            long long end = start + (1LL << d) - 1;
+            if (end > lastInternal) {
+                end = lastInternal;
+            }
+            for (long long i = end; i >= start; i--) {
+                maxHeapify(a, n, (int)i, compare, assign);
+            }
+        }
+    }
+
+    *comparisons = compare.get();
+    *assignments = assign.get();
+}
+
+void buildHeapParallel(int a[], int n, bool counting = true) {
+
+    Operation parallelCompare = p.createOperation("parallel-heapify-comparisons", n);
+    Operation parallelAssign = p.createOperation("parallel-heapify-assignments", n);
+
+    int nrThreads = threadCount();
+    int firstRoot = 0;
+    while (firstRoot + 1 < SUBTREES_PER_THREAD * nrThreads) {
+        firstRoot = left(firstRoot);
+    }
+    int lastRoot = n / 2 < left(firstRoot) ? n / 2 : left(firstRoot);
+
+    if (nrThreads > 1 && n >= PARALLEL_CUTOFF && firstRoot < lastRoot) {
+        unsigned int comparisons[MAX_THREADS];
+        unsigned int assignments[MAX_THREADS];
+        std::thread workers[MAX_THREADS];
+        int nrRoots = lastRoot - firstRoot;
+
+        for (int t = 0; t < nrThreads; t++) {
+            int from = firstRoot + (int)((long long)nrRoots * t / nrThreads);
+            int to = firstRoot + (int)((long long)nrRoots * (t + 1) / nrThreads);
+            workers[t] = std::thread(heapifySubtrees, a, n, from, to, counting, &comparisons[t], &assignments[t]);
+        }
+        for (int t = 0; t < nrThreads; t++) {
+            workers[t].join();
+            parallelCompare.count(comparisons[t]);
+            parallelAssign.count(assignments[t]);
+        }
+    } else {
+        firstRoot = n / 2;
+    }
+
+    for (int i = firstRoot - 1; i >= 0; i--) {
+        maxHeapify(a, n, i, parallelCompare, parallelAssign);
+    }
+}
+
+void floydSiftDown(int a[], int n, int hole, int x, Operation compare, Operation assign) {
+    int top = hole;
+    while (left(hole) < n) {
+        int child = left(hole);
+        if (child + 1 < n) {
+            compare.count();
+            if (a[child + 1] > a[child]) {
+                child++;
+            }
+        }
+        assign.count();
+        a[hole] = a[child];
+        hole = child;
+    }
+    while (hole > top) {
+        compare.count();
+        if (a[parent(hole)] >= x) {
+            break;
+        }
+        assign.count();
+        a[hole] = a[parent(hole)];
+        hole = parent(hole);
+    }
+    assign.count();
+    a[hole] = x;
+}
+
+void buildHeapFloyd(int a[], int n) {
+
+    Operation floydCompare = p.createOperation("floyd-heapify-comparisons", n);
+    Operation floydAssign = p.createOperation("floyd-heapify-assignments", n);
+
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        floydAssign.count();
+        floydSiftDown(a, n, i, a[i], floydCompare, floydAssign);
+    }
+}
+
+void FloydHeapSort(int a[], int n) {
+
+    Operation floydHeapSortCompare = p.createOperation("floyd-heapsort-comparisons", n);
+    Operation floydHeapSortAssign = p.createOperation("floyd-heapsort-assignments", n);
+
+    buildHeapFloyd(a, n);
+    for (int i = n - 1; i > 0; i--) {
+        floydHeapSortAssign.count(2);
+        int x = a[i];
+        a[i] = a[0];
+        floydSiftDown(a, i, 0, x, floydHeapSortCompare, floydHeapSortAssign);
+    }
+}
+
+void DaryHeapSort(int a[], int n, int d) {
+
+    char compareName[32];
+    char assignName[32];
+    snprintf(compareName, sizeof(compareName), "heapsort-%d-ary-comparisons", d);
+    snprintf(assignName, sizeof(assignName), "heapsort-%d-ary-assignments", d);
+    Operation daryCompare = p.createOperation(compareName, n);
+    Operation daryAssign = p.createOperation(assignName, n);
+
+    if (d == 8) {
+        daryHeapSort<8>(a, n, &daryCompare, &daryAssign);
+    } else {
+        daryHeapSort<4>(a, n, &daryCompare, &daryAssign);
+    }
+}
+
 void HeapSort(int a[], int n, void (*buildHeap)(int[], int)) {
 
     Operation heapSortCompare = p.createOperation("heapsort-comparisons", n);
@@ -173,11 +528,10 @@ void demo(int algorithm) {
     int n = sizeof(a)/sizeof(a[0]);
 
     if (algorithm == BUBBLE) {
-        int bubbleArr[n], recursiveBubbleArr[n];
-        for (int i = 0; i < n; i++) {
-            bubbleArr[i] = a[i];
-            recursiveBubbleArr[i] = a[i];
-        }
+        int bubbleArr[n], recursiveBubbleArr[n], oddEvenArr[n];
+        bulkCopy(bubbleArr, a, n);
+        bulkCopy(recursiveBubbleArr, a, n);
+        bulkCopy(oddEvenArr, a, n);
 
         bubbleSort(bubbleArr, n);
         for (int i = 0; i < n; i++)
@@ -188,14 +542,19 @@ void demo(int algorithm) {
         for (int i = 0; i < n; i++)
             printf("%d ", recursiveBubbleArr[i]);
         printf("\n");
+
+        oddEvenSort(oddEvenArr, n);
+        for (int i = 0; i < n; i++)
+            printf("%d ", oddEvenArr[i]);
+        printf("\n");
     }
 
     if (algorithm == HEAPSORT) {
-        int topDownArr[n], bottomUpArr[n];
-        for (int i = 0; i < n; i++) {
-            topDownArr[i] = a[i];
-            bottomUpArr[i] = a[i];
-        }
+        int topDownArr[n], bottomUpArr[n], floydArr[n], daryArr[n];
+        bulkCopy(topDownArr, a, n);
+        bulkCopy(bottomUpArr, a, n);
+        bulkCopy(floydArr, a, n);
+        bulkCopy(daryArr, a, n);
 
         buildHeapBottomUp(bottomUpArr, n);
         for (int i = 0; i < n; i++)
@@ -216,6 +575,16 @@ void demo(int algorithm) {
         for (int i = 0; i < n; i++)
             printf("%d ", topDownArr[i]);
         printf("\n");
+
+        FloydHeapSort(floydArr, n);
+        for (int i = 0; i < n; i++)
+            printf("%d ", floydArr[i]);
+        printf("\n");
+
+        DaryHeapSort(daryArr, n, 4);
+        for (int i = 0; i < n; i++)
+            printf("%d ", daryArr[i]);
+        printf("\n");
     }
 }
 
@@ -228,32 +597,54 @@ void perf(int algorithm, int order) {
             if (algorithm == BUBBLE) {
                 int* bubbleArr = new int[n];
                 int* recursiveBubbleArr = new int[n];
+                int* oddEvenArr = new int[n];
 
-                for (int j = 0; j < n; j++) {
-                    bubbleArr[j] = a[j];
-                    recursiveBubbleArr[j] = a[j];
-                }
+                bulkCopy(bubbleArr, a, n);
+                bulkCopy(recursiveBubbleArr, a, n);
+                bulkCopy(oddEvenArr, a, n);
 
                 bubbleSort(bubbleArr, n);
                 recursiveBubbleSortWrapper(recursiveBubbleArr, n);
+                oddEvenSort(oddEvenArr, n);
+
+                checkSorted("bubble", bubbleArr, n);
+                checkSorted("recursive-bubble", recursiveBubbleArr, n);
+                checkSorted("odd-even", oddEvenArr, n);
 
                 delete[] bubbleArr;
                 delete[] recursiveBubbleArr;
+                delete[] oddEvenArr;
             }
             if (algorithm == HEAPSORT) {
                 int* bottomUpArr = new int[n];
                 int* topDownArr = new int[n];
+                int* floydArr = new int[n];
+                int* fourAryArr = new int[n];
+                int* eightAryArr = new int[n];
 
-                for (int j = 0; j < n; j++) {
-                    bottomUpArr[j] = a[j];
-                    topDownArr[j] = a[j];
-                }
+                bulkCopy(bottomUpArr, a, n);
+                bulkCopy(topDownArr, a, n);
+                bulkCopy(floydArr, a, n);
+                bulkCopy(fourAryArr, a, n);
+                bulkCopy(eightAryArr, a, n);
 
                 HeapSort(bottomUpArr, n, buildHeapBottomUp);
                 HeapSort(topDownArr, n, buildHeapTopDown);
+                FloydHeapSort(floydArr, n);
+                DaryHeapSort(fourAryArr, n, 4);
+                DaryHeapSort(eightAryArr, n, 8);
+
+                checkSorted("heapsort-bottomup", bottomUpArr, n);
+                checkSorted("heapsort-topdown", topDownArr, n);
+                checkSorted("heapsort-floyd", floydArr, n);
+                checkSorted("heapsort-4-ary", fourAryArr, n);
+                checkSorted("heapsort-8-ary", eightAryArr, n);
 
                 delete[] bottomUpArr;
                 delete[] topDownArr;
+                delete[] floydArr;
+                delete[] fourAryArr;
+                delete[] eightAryArr;
             }
         }
         if (algorithm == BUBBLE) {
@@ -262,21 +653,76 @@ void perf(int algorithm, int order) {
 
             for (int i = 0; i < nr_tests; i++) {
                 p.startTimer("bubble-time", n);
-                for (int j = 0; j < n; j++) {
-                    bubbleArrTime[j] = a[j];
-                }
+                bulkCopy(bubbleArrTime, a, n);
                 bubbleSort(bubbleArrTime, n);
                 p.stopTimer("bubble-time", n);
+                checkSorted("bubble-time", bubbleArrTime, n);
             }
         
             for (int i = 0; i < nr_tests; i++) {
                 p.startTimer("recursive-bubble-time", n);
-                for (int j = 0; j < n; j++) {
-                    recursiveBubbleArrTime[j] = a[j];
-                }
+                bulkCopy(recursiveBubbleArrTime, a, n);
                 recursiveBubbleSortWrapper(recursiveBubbleArrTime, n);
                 p.stopTimer("recursive-bubble-time", n);
+                checkSorted("recursive-bubble-time", recursiveBubbleArrTime, n);
             }
+
+            int* oddEvenArrTime = new int[n];
+            for (int i = 0; i < nr_tests; i++) {
+                p.startTimer("odd-even-time", n);
+                bulkCopy(oddEvenArrTime, a, n);
+                oddEvenSort(oddEvenArrTime, n);
+                p.stopTimer("odd-even-time", n);
+                checkSorted("odd-even-time", oddEvenArrTime, n);
+            }
+            timeStdBaselines(p, "time", a, oddEvenArrTime, n, nr_tests);
+            delete[] oddEvenArrTime;
+        }
+        if (algorithm == HEAPSORT) {
+            int* heapArrTime = new int[n];
+
+            p.startTimer("heapsort-bottomup-time", n);
+            for (int i = 0; i < nr_tests; i++) {
+                bulkCopy(heapArrTime, a, n);
+                HeapSort(heapArrTime, n, buildHeapBottomUp);
+            }
+            p.stopTimer("heapsort-bottomup-time", n);
+            checkSorted("heapsort-bottomup-time", heapArrTime, n);
+
+            p.startTimer("heapsort-topdown-time", n);
+            for (int i = 0; i < nr_tests; i++) {
+                bulkCopy(heapArrTime, a, n);
+                HeapSort(heapArrTime, n, buildHeapTopDown);
+            }
+            p.stopTimer("heapsort-topdown-time", n);
+            checkSorted("heapsort-topdown-time", heapArrTime, n);
+
+            p.startTimer("heapsort-floyd-time", n);
+            for (int i = 0; i < nr_tests; i++) {
+                bulkCopy(heapArrTime, a, n);
+                FloydHeapSort(heapArrTime, n);
+            }
+            p.stopTimer("heapsort-floyd-time", n);
+            checkSorted("heapsort-floyd-time", heapArrTime, n);
+
+            p.startTimer("heapsort-4-ary-time", n);
+            for (int i = 0; i < nr_tests; i++) {
+                bulkCopy(heapArrTime, a, n);
+                DaryHeapSort(heapArrTime, n, 4);
+            }
+            p.stopTimer("heapsort-4-ary-time", n);
+            checkSorted("heapsort-4-ary-time", heapArrTime, n);
+
+            p.startTimer("heapsort-8-ary-time", n);
+            for (int i = 0; i < nr_tests; i++) {
+                bulkCopy(heapArrTime, a, n);
+                DaryHeapSort(heapArrTime, n, 8);
+            }
+            p.stopTimer("heapsort-8-ary-time", n);
+            checkSorted("heapsort-8-ary-time", heapArrTime, n);
+
+            timeStdBaselines(p, "time", a, heapArrTime, n, nr_tests);
+            delete[] heapArrTime;
         }
     }
     delete[] a;
@@ -289,10 +735,17 @@ void perf(int algorithm, int order) {
         p.divideValues("recursive-bubble-assignments", m);
         p.addSeries("recursive-bubble-total", "recursive-bubble-comparisons", "recursive-bubble-assignments");
 
+        p.divideValues("odd-even-comparisons", m);
+        p.divideValues("odd-even-assignments", m);
+        p.addSeries("odd-even-total", "odd-even-comparisons", "odd-even-assignments");
+
         p.createGroup("Iterative Bubble Operations", "bubble-comparisons", "bubble-assignments", "bubble-total");
         p.createGroup("Recursive Bubble Operations", "recursive-bubble-comparisons", "recursive-bubble-assignments", "recursive-bubble-total");
-        p.createGroup("Total Operations", "bubble-total", "recursive-bubble-total");
-        p.createGroup("Bubble Times", "bubble-time", "recursive-bubble-time");
+        p.createGroup("Odd-Even Transposition Operations", "odd-even-comparisons", "odd-even-assignments", "odd-even-total");
+        p.createGroup("Total Operations", "bubble-total", "recursive-bubble-total", "odd-even-total");
+        p.createGroup("Bubble Times", "bubble-time", "recursive-bubble-time", "odd-even-time");
+        p.createGroup("Bubble vs Standard Library Times", "bubble-time", "recursive-bubble-time", "odd-even-time",
+            STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
     }
     if (algorithm == HEAPSORT) {
         p.divideValues("heapify-comparisons", m);
@@ -307,15 +760,80 @@ void perf(int algorithm, int order) {
         p.divideValues("heapsort-assignments", 2 * m);
         p.addSeries("heapsort-total", "heapsort-comparisons", "heapsort-assignments");
 
+        p.divideValues("floyd-heapify-comparisons", m);
+        p.divideValues("floyd-heapify-assignments", m);
+        p.addSeries("floyd-heapify-total", "floyd-heapify-comparisons", "floyd-heapify-assignments");
+
+        p.divideValues("floyd-heapsort-comparisons", m);
+        p.divideValues("floyd-heapsort-assignments", m);
+        p.addSeries("floyd-heapsort-total", "floyd-heapsort-comparisons", "floyd-heapsort-assignments");
+
+        p.divideValues("heapsort-4-ary-comparisons", m);
+        p.divideValues("heapsort-4-ary-assignments", m);
+        p.addSeries("heapsort-4-ary-total", "heapsort-4-ary-comparisons", "heapsort-4-ary-assignments");
+
+        p.divideValues("heapsort-8-ary-comparisons", m);
+        p.divideValues("heapsort-8-ary-assignments", m);
+        p.addSeries("heapsort-8-ary-total", "heapsort-8-ary-comparisons", "heapsort-8-ary-assignments");
+
         p.addSeries("heapsort-bottomup-total", "heapify-total", "heapsort-total");
         p.addSeries("heapsort-topdown-total", "siftup-total", "heapsort-total");
+        p.addSeries("heapsort-floyd-total", "floyd-heapify-total", "floyd-heapsort-total");
 
         p.createGroup("Heapify (Bottom-Up) Operations", "heapify-comparisons", "heapify-assignments", "heapify-total");
         p.createGroup("Sift-Up (Top-Down) Operations", "siftup-comparisons", "siftup-assignments", "siftup-total");
         p.createGroup("HeapSort (Extraction) Operations", "heapsort-comparisons", "heapsort-assignments", "heapsort-total");
-        p.createGroup("Heap Building Operations", "heapify-total", "siftup-total");
-        p.createGroup("Total HeapSort Operations", "heapsort-total", "heapsort-bottomup-total", "heapsort-topdown-total");
+        p.createGroup("Floyd HeapSort (Extraction) Operations", "floyd-heapsort-comparisons", "floyd-heapsort-assignments", "floyd-heapsort-total");
+        p.createGroup("Heap Building Operations", "heapify-total", "siftup-total", "floyd-heapify-total");
+        p.createGroup("HeapSort vs Floyd HeapSort Comparisons", "heapsort-comparisons", "floyd-heapsort-comparisons");
+        p.createGroup("Total HeapSort Operations", "heapsort-total", "heapsort-bottomup-total", "heapsort-topdown-total", "heapsort-floyd-total");
+        p.createGroup("Binary vs D-ary HeapSort Operations", "heapsort-bottomup-total", "heapsort-4-ary-total", "heapsort-8-ary-total");
+        p.createGroup("HeapSort Times", "heapsort-bottomup-time", "heapsort-topdown-time", "heapsort-floyd-time", "heapsort-4-ary-time",
+            "heapsort-8-ary-time");
+        p.createGroup("HeapSort vs Standard Library Times", "heapsort-bottomup-time", "heapsort-floyd-time", "heapsort-4-ary-time",
+            "heapsort-8-ary-time", STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"),
+            STD_PAR_SORT_SERIES("time"));
+    }
+}
+
+void perfBuildHeap() {
+    int* a = new int[LARGE_MAX_SIZE];
+    int* heapArr = new int[LARGE_MAX_SIZE];
+    int n;
+    for (n = LARGE_STEP_SIZE; n <= LARGE_MAX_SIZE; n += LARGE_STEP_SIZE) {
+        FillRandomArray(a, n, 10, 50000, false, UNSORTED);
+        for (int i = 0; i < NR_LARGE_TESTS; i++) {
+            bulkCopy(heapArr, a, n);
+            p.startTimer("heapify-large-time", n);
+            buildHeapBottomUp(heapArr, n);
+            p.stopTimer("heapify-large-time", n);
+            checkMaxHeap("heapify-large-time", heapArr, n);
+
+            bulkCopy(heapArr, a, n);
+            p.startTimer("siftup-large-time", n);
+            buildHeapTopDown(heapArr, n);
+            p.stopTimer("siftup-large-time", n);
+            checkMaxHeap("siftup-large-time", heapArr, n);
+
+            bulkCopy(heapArr, a, n);
+            p.startTimer("parallel-heapify-large-time", n);
+            buildHeapParallel(heapArr, n, false);
+            p.stopTimer("parallel-heapify-large-time", n);
+            checkMaxHeap("parallel-heapify-large-time", heapArr, n);
+
+            bulkCopy(heapArr, a, n);
+            p.startTimer("std-make-heap-large-time", n);
+            std::make_heap(heapArr, heapArr + n);
+            p.stopTimer("std-make-heap-large-time", n);
+        }
+        timeStdBaselines(p, "large-time", a, heapArr, n, NR_LARGE_TESTS);
     }
+    delete[] a;
+    delete[] heapArr;
+
+    p.createGroup("Heap Building Times", "heapify-large-time", "siftup-large-time", "parallel-heapify-large-time", "std-make-heap-large-time");
+    p.createGroup("Standard Library Sort Large Times", STD_SORT_SERIES("large-time"), STD_STABLE_SORT_SERIES("large-time"),
+        STD_HEAP_SORT_SERIES("large-time"), STD_PAR_SORT_SERIES("large-time"));
 }
 
 void perf_all() {
@@ -324,6 +842,8 @@ void perf_all() {
     perf(HEAPSORT, ASCENDING);
     p.reset("Bubble - Average Case");
     perf(BUBBLE, UNSORTED);
+    p.reset("Heap Building - Large Arrays");
+    perfBuildHeap();
     p.showReport();
 }
 
@@ -334,6 +854,7 @@ int main() {
     // perf(BUBBLE, UNSORTED);
     // perf(HEAPSORT, UNSORTED);
     // perf(HEAPSORT, ASCENDING);
+    // perfBuildHeap();
     // perf_all();
     return 0;
 }
\ No newline at end of file
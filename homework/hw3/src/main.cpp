@@ -9,12 +9,93 @@
     HeapSort: Construieste un max-heap folosind `maxHeapify`, apoi extrage maximul repetat pentru a sorta array-ul. Complexitatea este
     O(n log n) in toate cazurile,  dar cu mai multe operatii decat QuickSort in medie.
 
+    Floyd HeapSort: Aceeasi sortare, dar cu cernere "bottom-up" iterativa: elementul de plasat lasa o gaura care coboara pana la o frunza
+    pe copilul mai mare (o comparatie si o atribuire pe nivel, fara interschimbari), apoi elementul urca inapoi de obicei doar 1-2 niveluri.
+    Comparatiile scad aproximativ la jumatate fata de `maxHeapify`. Este folosit si ca fallback in Adaptive Sort.
+
+    D-ary HeapSort (Heap.h): heap cu HEAP_ARITY copii consecutivi pe nod, deci mai putine niveluri si linii de cache atinse pe cernere.
+    In HEAP_LAYOUT_ANALYSIS timpii pe vectori mari (4-ar si 8-ar) sunt comparati cu heap-ul binar, Floyd HeapSort si Hybrid QuickSort;
+    pe vectori mari diferenta vine in principal din accesele la memorie, nu din numarul de operatii.
+
     Hybrid QuickSort: O varianta a QuickSort-ului care comuta la Insertion Sort pentru subvectori mai mici decat un prag (threshold).
-    Insertion Sort este implementat cu cautare binara pentru pozitia de insertie, optimizand numarul de comparatii. Acest hibrid reduce overhead-ul
+    Insertion Sort este implementat cu cautare binara pentru pozitia de insertie, optimizand numarul de comparatii. Cautarea binara este fara
+    salturi (pozitia se actualizeaza aritmetic), elementele se deplaseaza in bloc cu memmove, iar un element deja la locul lui costa o singura
+    comparatie. Insertia ramane stabila (se insereaza dupa elementele egale). Acest hibrid reduce overhead-ul
     recursivitatii pentru array-uri mici, imbunatatind performanta in cazuri practice. Pragul optim este in jur de 10-25, determinat prin analiza.
 
     QuickSort randomizat (QuickSelect): Alege pivorul aleatoriu. Partitionarea este similara, dar cu swap initial pentru pivotul random.
 
+    Selectie (Introselect): select(a, n, k) pune pe pozitia k elementul de rang k (ca in vectorul sortat), cu cele mai mici in stanga si
+    cele mai mari in dreapta, fara a sorta tot vectorul. Pivotul este ales aleatoriu, iar partitionarea este in 3 (<, ==, > pivot), deci
+    duplicatele nu strica performanta; se continua doar in partea care contine rangul k. Daca prea multe partitii pastreaza peste 3/4 din
+    elemente (log n partitii proaste), pivotul devine mediana medianelor (grupuri de 5), care garanteaza cazul defavorabil liniar.
+    Intervalele mici sunt terminate cu `hybridBaseCase`. partialSortTopK(a, n, k) aduce cele mai mici k elemente, sortate, la inceput
+    (select + sortarea doar a primelor k cu floydHeapSort, deci O(k log k) si pe prefixe deja sortate, unde pivotul de la capat al
+    Hybrid QuickSort ar fi patratic), iar selectMany(a, n, ks, nrKs) fixeaza mai multe ranguri deodata (de exemplu percentile): se
+    selecteaza rangul din mijloc, apoi rangurile mai mici si mai mari se rezolva recursiv doar in jumatatea lor.
+        Average Case: O(n), Worst Case: O(n); selectMany: O(n log nrKs); partialSortTopK: O(n + k log k)
+
+    Radix Sort (LSD): Sortare fara comparatii pentru chei intregi pe 32 de biti, cu cifre de RADIX_BITS (8) biti. Toate histogramele se
+    calculeaza intr-o singura trecere peste vector; cifrele pentru care toate elementele cad in aceeasi galeata (de exemplu octetii superiori,
+    deoarece valorile sunt in intervalul 10..50000) sunt sarite. Distributia se face alternativ intre vector si un buffer auxiliar (ping-pong),
+    deci spatiul suplimentar este O(n). Complexitatea este O(n * RADIX_PASSES), liniara in n.
+
+    MSD Radix Sort (in loc, paralel): Varianta fara buffer auxiliar, pornind de la octetul cel mai semnificativ (American flag sort).
+    Histograma cifrei curente se calculeaza pe felii, cate una pe fir, si se insumeaza; daca toate elementele au aceeasi cifra, se trece
+    direct la urmatoarea. Permutarea in galeti se face in runde (ca in PARADIS / regions sort): zona nerezolvata a fiecarei galeti este
+    impartita in fasii egale, una pe fir, iar fiecare fir muta elementele doar intre fasiile proprii (fara sincronizare). Elementele care
+    nu mai au loc in fasia destinatie sunt parcate la sfarsitul fasiei curente; apoi, pentru fiecare galeata, elementele parcate sunt
+    mutate la sfarsitul galetii prin interschimbari, iar runda urmatoare lucreaza doar pe ce a ramas. Sub PARALLEL_CUTOFF elemente ramase
+    (sau daca o runda nu mai avanseaza) permutarea se termina secvential. Galetile se sorteaza recursiv pe cifra urmatoare: cele mari
+    (peste n / fire) tot in paralel, celelalte impartite intre fire in grupuri cu acelasi numar total de elemente. Intervalele de cel mult
+    MSD_RADIX_CUTOFF (64) elemente sunt terminate cu Hybrid QuickSort. Se numara doar atribuirile (plus comparatiile din Hybrid QuickSort);
+    fiecare fir numara intr-un Profiler propriu, oprit in masuratorile de timp (counting = false), ca la Parallel Multiway Merge Sort.
+        Complexitate: O(n * RADIX_PASSES), spatiu suplimentar O(fire * RADIX_BUCKETS)
+
+    Adaptive Sort (pattern-defeating): Porneste de la Hybrid QuickSort si adauga detectia tiparelor din date. Inainte de sortare se verifica
+    daca vectorul este deja crescator (nu se face nimic) sau descrescator (se inverseaza in O(n)). Pivotul este mediana din 3 (sau ninther
+    pentru partitii mari), iar partitionarea raporteaza daca partitia era deja impartita fara interschimbari; in acest caz se incearca un
+    insertion sort partial care renunta dupa PARTIAL_INSERTION_LIMIT mutari. Partitiile foarte dezechilibrate (sub 1/8) amesteca cateva
+    elemente pentru a strica tiparele adverse, iar dupa log(n) astfel de partitii se trece la HeapSort, deci cazul defavorabil ramane
+    O(n log n). Elementele egale cu pivotul precedent sunt grupate separat, ceea ce ajuta la multe duplicate.
+        Average Case: O(n log n), Best Case (crescator / descrescator): O(n), Worst Case: O(n log n)
+
+    SIMD Sort (AVX2): QuickSort vectorizat pentru int. Partitionarea citeste cate 8 elemente, le compara cu pivotul intr-un singur
+    registru, iar masca rezultata (8 biti) alege din SIMD_COMPRESS_TABLE permutarea care aduna elementele <= pivot la inceput si pe cele
+    > pivot la sfarsit; registrul permutat este scris intreg si in partea stanga, si in partea dreapta, iar cursoarele avanseaza cu numarul
+    de elemente din fiecare parte. Partitionarea este in loc: primii si ultimii 8 elemente sunt salvati la inceput, deci exista mereu 16
+    pozitii libere, iar urmatorul bloc se citeste din partea cu mai putin spatiu liber. Partitiile de cel mult SIMD_BASE_CASE (16)
+    elemente sunt sortate in registre cu retele bitonice (6 pasi min / max pentru 8 elemente, plus interclasarea a doua registre),
+    completate cu INT_MAX si scrise cu store mascat. Daca pivotul este maximul partitiei, se separa elementele egale cu pivotul, iar
+    dupa 2 log n niveluri se trece la Floyd HeapSort. Procesorul este verificat la rulare (__builtin_cpu_supports); fara AVX2 sau pe
+    alt compilator / arhitectura se foloseste Hybrid QuickSort. Contoarele numara n comparatii si n atribuiri pe partitionare si 4
+    comparatii / 8 atribuiri pe pas al retelei (un pas = 4 compare-exchange in paralel).
+
+    Natural Merge Sort: Sortare stabila care exploateaza secventele deja ordonate din date. Vectorul este parcurs de la stanga la dreapta si
+    se detecteaza run-uri naturale (crescatoare, sau strict descrescatoare care sunt inversate). Run-urile mai scurte decat minRun (intre 16
+    si 32) sunt extinse cu insertie binara, ca in Insertion Sort (v2). Run-urile sunt puse pe o stiva si interclasate astfel incat lungimile
+    sa respecte invariantii de echilibru, deci adancimea stivei este O(log n). Interclasarea copiaza doar run-ul mai scurt intr-un singur
+    buffer reutilizat (n/2 elemente) si trece in modul "galloping" (cautare exponentiala + binara) cand un run castiga de MIN_GALLOP ori la rand.
+        Average Case: O(n log n), Best Case: O(n), Worst Case: O(n log n); spatiu suplimentar O(n / 2)
+
+    Parallel Multiway Merge Sort: Vectorul este impartit in p bucati (p = numarul de fire de executie), fiecare sortata concurent cu
+    Adaptive Sort (Hybrid QuickSort cu detectie de tipare). Apoi iesirea este impartita in p felii egale; pentru fiecare granita se cauta
+    binar valoarea de rang dat si pozitiile de taiere in toate cele p bucati (multisequence selection), astfel incat fiecare fir
+    interclaseaza independent, cu un min-heap de dimensiune p (ca in tema 4), exact felia lui de iesire. Fiecare fir numara operatiile intr-un
+    Profiler propriu, iar totalurile se aduna dupa join, deci contoarele nu sunt accesate concurent. In masuratorile de timp (counting = false)
+    contoarele firelor sunt oprite, ca si cele ale lui p cat timp ruleaza cronometrul.
+        Timp: O((n log n) / p + n log p / p), spatiu suplimentar O(n)
+
+    External Merge Sort: Pentru fisiere binare de int mai mari decat memoria. Fisierul este citit in bucati de `chunkSize` elemente, fiecare
+    bucata este sortata in memorie cu Parallel Multiway Merge Sort (Adaptive Sort pe fiecare fir) si scrisa intr-un fisier temporar
+    (run). Run-urile sunt apoi interclasate cu acelasi min-heap de run-uri: memoria de `chunkSize` elemente se imparte in k + 1 buffere mari
+    (k intrari si o iesire), reumplute / golite cu fread / fwrite secventiale. Daca sunt mai mult de EXTERNAL_MAX_FANIN run-uri, se fac
+    mai multe treceri de interclasare. Memoria folosita este O(chunkSize), indiferent de dimensiunea fisierului. Dupa fiecare fread scurt
+    se verifica ferror: o eroare de citire (din fisierul de intrare sau dintr-un run) opreste sortarea cu rezultat false, in loc sa fie
+    tratata ca sfarsit de fisier. In perfLarge rezultatul lui externalSort este verificat dupa cronometru: fisierul de iesire este citit si
+    verificat cu checkSorted, iar la o eroare seria se opreste.
+        Timp: O(n log n) comparatii, O(n * treceri) citiri / scrieri secventiale
+
     QuickSort:
         Average Case: O(n log n)
         Best Case: O(n log n)
@@ -23,23 +104,94 @@
     HeapSort vs QuickSort:
         Average Case: HeapSort este consistent, dar QuickSort e mai rapid in practica.
 
+    Retele de sortare (sorting networks): Partitiile de cel mult MAX_NETWORK_SIZE (16) elemente din Hybrid QuickSort (si Adaptive Sort)
+    sunt sortate cu retele de sortare de dimensiune minima cunoscuta (1, 3, 5, 9, 12, 16, 19, 25, 29, 35, 39, 45, 51, 56, 60 comparatori
+    pentru n = 2..16). Fiecare comparator este un compare-exchange fara salturi (min/max, compilat ca cmov), deci frunzele recursivitatii nu
+    mai au ramificatii imprevizibile. Secventa de comparatori depinde doar de n, deci numarul de comparatii este fix; in schimb, fiecare
+    comparator scrie ambele pozitii. Pentru partitii mai mari (praguri peste 16) se foloseste in continuare Insertion Sort cu cautare binara.
+    Cazul de baza este ales prin pointerul global `hybridBaseCase`, astfel incat varianta cu Insertion Sort poate fi comparata direct.
+    Retelele si Insertion Sort cu cautare binara sunt cele din Sort.h (networkSort, binaryInsertionSort); sortingNetworkSort, insertionSort
+    si insertionSortFrom sunt doar adaptoare cu semnatura temei (Operation prin valoare), pentru pointerul `hybridBaseCase`.
+
+    Generic Hybrid Sort (Sort.h): Hybrid QuickSort ca template peste iterator, extractor de cheie si comparator, folosit si de tema 8 pentru
+    sortarea muchiilor. Pentru chei aritmetice cu comparatorul implicit se alege la compilare partitionarea fara salturi si reteaua de sortare.
+    hybridQuickSort din tema este tot Sort.h (hybridSortWithBaseCase: pivot mediana din 3, separarea cheilor egale), dar cu pragul
+    `hybridThreshold` si cazul de baza `hybridBaseCase` alese la rulare (calibrare); seria generic-sort foloseste valorile implicite din
+    Sort.h. Analiza generic-sort include si intrari "organ pipe" (crescator, apoi descrescator; ORGAN_PIPE), pe care mediana din 3 ar
+    degenera fara bugetul de adancime din Sort.h. QuickSort (partition, quickSort) ramane varianta clasica din curs, cu pivotul ultimul
+    element, pentru care sunt generate cazurile favorabil / defavorabil din analiza.
+
+    Calibrare la rulare: calibrateHybrid() masoara timpul (nu numarul de operatii) pentru cateva praguri candidate si ambele cazuri de baza
+    (Insertion Sort / retele de sortare) pe un vector aleator de TUNING_SIZE elemente, pastrand minimul din TUNING_REPEATS rulari; totul dureaza
+    sub o secunda. Castigatorul este scris in TUNING_CACHE_FILE, pe cate o linie "procesor|tip|prag|caz_de_baza", iar loadHybridTuning(),
+    apelat la inceputul lui main, seteaza `hybridThreshold` si `hybridBaseCase` daca exista o intrare pentru procesorul curent si tipul int.
+    Fara fisier se folosesc valorile implicite (OPTIMAL_THRESHOLD si retelele de sortare).
+
     Analiza pragului hibrid:
         Pragul optim este ~15, unde hibridul minimizeaza operatiile; sub acest prag, overhead-ul Insertion Sort creste; peste, recursivitatea 
         QuickSort devine ineficienta pentru mici subarray-uri.
 
     QuickSort vs Hybrid QuickSort:
        Hybrid e superior, reducand marginal operatiile si timpul de executie.
+
+    Pregatire si verificare: populateArray copiaza cu bulkCopy din ArrayUtil.h (scrieri non-temporale pentru vectorii mari, memcpy in
+    rest), iar perfLarge verifica rezultatul fiecarei dimensiuni cu checkSorted (arraySorted: SSE2, 4 perechi vecine pe comparatie);
+    daca vectorul nu este sortat, se afiseaza numarul de secvente, cea mai lunga secventa, prima coborare si estimarea inversiunilor
+    (analyzeRuns). Verificarea este in afara cronometrului.
+
+    Repere: fiecare grup de timpi din perfAnalysis contine si std::sort, std::stable_sort, std::make_heap + std::sort_heap si, cu
+    -DBASELINE_PARALLEL_STL (-ltbb), std::sort(std::execution::par), masurate pe aceleasi dimensiuni si acelasi tip de intrare
+    (perf / perfLarge cu STD_BASELINES, prin Baselines.h).
 */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <chrono>
+#include <limits.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#include <immintrin.h>
+#define SIMD_SORT_AVAILABLE
+#define SIMD_TARGET __attribute__((target("avx2,popcnt")))
+#endif
 #include "Profiler.h"
+#include "Sort.h"
+#include "Heap.h"
+#include "ArrayUtil.h"
+#include "Baselines.h"
 
 #define MAX_SIZE 10000
 #define STEP_SIZE 100
 #define MAX_THRESHOLD 50
 #define NR_TESTS 1000
 #define OPTIMAL_THRESHOLD 15
+#define HEAP_ARITY 4
+#define TUNING_CACHE_FILE "hybrid-tuning.txt"
+#define TUNING_SIZE 50000
+#define TUNING_REPEATS 3
+#define MAX_LINE 256
+#define LARGE_MAX_SIZE 5000000
+#define LARGE_STEP_SIZE 500000
+#define NR_LARGE_TESTS 5
+#define RADIX_BITS 8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+#define RADIX_PASSES (32 / RADIX_BITS)
+#define PARTIAL_INSERTION_LIMIT 8
+#define SIMD_BASE_CASE 16
+#define NINTHER_THRESHOLD 128
+#define MIN_MERGE 32
+#define MIN_GALLOP 7
+#define MAX_RUNS 85
+#define MAX_THREADS 64
+#define PARALLEL_CUTOFF 65536
+#define MSD_RADIX_CUTOFF 64
+#define EXTERNAL_MAX_FANIN 64
+#define EXTERNAL_IO_BUFFER (1 << 20)
+#define EXTERNAL_CHUNK_DIVISOR 8
+#define MAX_FILE_NAME 512
+#define ORGAN_PIPE 3
 
 int m = 5;
 int temp = 0;
@@ -48,14 +200,45 @@ enum algorithm {
     QUICKSORT = 0,
     HEAPSORT = 1,
     HYBRID_QUICKSORT = 2,
-    QUICKSELECT = 3
+    QUICKSELECT = 3,
+    RADIX_SORT = 4,
+    ADAPTIVE_SORT = 5,
+    NATURAL_MERGESORT = 6,
+    PARALLEL_MERGESORT = 7,
+    GENERIC_HYBRID_SORT = 8,
+    INTROSELECT = 9,
+    EXTERNAL_SORT = 10,
+    FLOYD_HEAPSORT = 11,
+    DARY_HEAPSORT = 12,
+    SIMD_SORT = 13,
+    MSD_RADIX_SORT = 14,
+    STD_BASELINES = 15
 };
 
 enum testMode {
     QUICKSORT_ANALYSIS = 0,
     HEAPSORT_VS_QUICKSORT = 1,
     HYBRID_THRESHOLD_ANALYSIS = 2,
-    QUICKSORT_VS_HYBRID_QUICKSORT = 3
+    QUICKSORT_VS_HYBRID_QUICKSORT = 3,
+    RADIX_VS_HYBRID_QUICKSORT = 4,
+    ADAPTIVE_SORT_ANALYSIS = 5,
+    MERGESORT_ANALYSIS = 6,
+    PARALLEL_MERGESORT_ANALYSIS = 7,
+    BASE_CASE_ANALYSIS = 8,
+    GENERIC_SORT_ANALYSIS = 9,
+    SELECTION_ANALYSIS = 10,
+    EXTERNAL_SORT_ANALYSIS = 11,
+    HEAP_LAYOUT_ANALYSIS = 12,
+    SIMD_SORT_ANALYSIS = 13,
+    MSD_RADIX_ANALYSIS = 14
+};
+
+struct MergeState {
+    int* buffer;
+    int minGallop;
+    int runBase[MAX_RUNS];
+    int runLength[MAX_RUNS];
+    int stackSize;
 };
 
 Profiler p;
@@ -67,8 +250,12 @@ void swap(int &a, int &b) {
 }
 
 void populateArray(int src[], int dest[], int n) {
+    bulkCopy(dest, src, n);
+}
+
+void fillOrganPipe(int a[], int n) {
     for (int i = 0; i < n; i++) {
-        dest[i] = src[i];
+        a[i] = i < n - i ? i : n - i;
     }
 }
 
@@ -99,24 +286,84 @@ void maxHeapify(int a[], int n, int i, Operation compare, Operation assign) {
     }
 }
 
+void heapSort(int a[], int n, Operation compare, Operation assign) {
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        maxHeapify(a, n, i, compare, assign);
+    }
+
+    int heap_size = n;
+    for (int i = n - 1; i > 0; i--) {
+        assign.count(3);
+        swap(a[0], a[i]);
+        heap_size--;
+        maxHeapify(a, heap_size, 0, compare, assign);
+    }
+}
+
 void heapSort(int a[], int n) {
 
     Operation heapSortCompare = p.createOperation("heapsort-comparisons", n);
     Operation heapSortAssign = p.createOperation("heapsort-assignments", n);
 
-    for (int i = n / 2 - 1; i >= 0; i--) {
-        maxHeapify(a, n, i, heapSortCompare, heapSortAssign);
+    heapSort(a, n, heapSortCompare, heapSortAssign);
+}
+
+void floydSiftDown(int a[], int n, int hole, int x, Operation compare, Operation assign) {
+    int top = hole;
+    int child = 2 * hole + 1;
+    while (child < n) {
+        if (child + 1 < n) {
+            compare.count();
+            if (a[child + 1] > a[child]) {
+                child++;
+            }
+        }
+        assign.count();
+        a[hole] = a[child];
+        hole = child;
+        child = 2 * hole + 1;
+    }
+    while (hole > top) {
+        int parent = (hole - 1) / 2;
+        compare.count();
+        if (a[parent] >= x) {
+            break;
+        }
+        assign.count();
+        a[hole] = a[parent];
+        hole = parent;
     }
+    assign.count();
+    a[hole] = x;
+}
 
-    int heap_size = n;
+void floydHeapSort(int a[], int n, Operation compare, Operation assign) {
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        assign.count();
+        floydSiftDown(a, n, i, a[i], compare, assign);
+    }
     for (int i = n - 1; i > 0; i--) {
-        heapSortAssign.count(3);
-        swap(a[0], a[i]);
-        heap_size--;
-        maxHeapify(a, heap_size, 0, heapSortCompare, heapSortAssign);
+        assign.count(2);
+        int x = a[i];
+        a[i] = a[0];
+        floydSiftDown(a, i, 0, x, compare, assign);
     }
 }
 
+void floydHeapSortWrapper(int a[], int n) {
+    Operation floydHeapSortCompare = p.createOperation("floyd-heapsort-comparisons", n);
+    Operation floydHeapSortAssign = p.createOperation("floyd-heapsort-assignments", n);
+
+    floydHeapSort(a, n, floydHeapSortCompare, floydHeapSortAssign);
+}
+
+void daryHeapSortWrapper(int a[], int n) {
+    Operation daryHeapSortCompare = p.createOperation("dary-heapsort-comparisons", n);
+    Operation daryHeapSortAssign = p.createOperation("dary-heapsort-assignments", n);
+
+    daryHeapSort<HEAP_ARITY>(a, n, &daryHeapSortCompare, &daryHeapSortAssign);
+}
+
 int partition(int a[], int left, int right, Operation compare, Operation assign) {
 
     int pivot = a[right];
@@ -160,39 +407,28 @@ void generateBestCaseQuickSort(int a[], int left, int right) {
     swap(a[right], a[mid]);
 }
 
+void insertionSortFrom(int a[], int n, int start, Operation compare, Operation assign) {
+    binaryInsertionSortFrom(a, n, start, IdentityKey(), KeyLess(), &compare, &assign);
+}
+
 void insertionSort(int a[], int n, Operation compare, Operation assign) {
-    for (int i = 1; i < n; i++) {   
-        assign.count();
-        int key = a[i];
-        int left = 0, right = i - 1;
-        while (left <= right) {
-            int mid = left + (right - left) / 2;
-            compare.count();
-            if (a[mid] > key) {
-                right = mid - 1;
-            } else {
-                left = mid + 1;
-            }
-        }
-        for (int j = i - 1; j >= left; j--) {
-            assign.count();
-            a[j + 1] = a[j];
-        }
-        assign.count();
-        a[left] = key;
-    }
+    binaryInsertionSort(a, n, IdentityKey(), KeyLess(), &compare, &assign);
+}
+
+void sortingNetworkSort(int a[], int n, Operation compare, Operation assign) {
+    networkSort(a, n, IdentityKey(), KeyLess(), &compare, &assign);
 }
 
+void (*hybridBaseCase)(int[], int, Operation, Operation) = sortingNetworkSort;
+int hybridThreshold = OPTIMAL_THRESHOLD;
+
 void hybridQuickSort(int a[], int left, int right, int threshold, Operation compare, Operation assign) {
-    if (right - left + 1 <= threshold) {
-        insertionSort(a + left, right - left + 1, compare, assign);
-    } else {
-        if (left < right) {
-            int pivotIndex = partition(a, left, right, compare, assign);
-            hybridQuickSort(a, left, pivotIndex - 1, threshold, compare, assign);
-            hybridQuickSort(a, pivotIndex + 1, right, threshold, compare, assign);
-        }
+    if (left >= right) {
+        return;
     }
+    hybridSortWithBaseCase(a + left, a + right + 1, IdentityKey(), KeyLess(), [&](int* first, int n) {
+        hybridBaseCase(first, n, compare, assign);
+    }, &compare, &assign, threshold);
 }
 
 void hybridQuickSortWrapper(int a[], int n, int threshold) {
@@ -228,192 +464,2846 @@ void quickSelect(int a[], int left, int right) {
     }
 }
 
-void demo(int algorithm) {
-    int a[] = {64, 34, 25, 12, 22, 11, 90};
-    int n = sizeof(a)/sizeof(a[0]);
-
-    switch (algorithm) {
-        case QUICKSORT: {
-            int quickSortArray[n];
-
-            populateArray(a, quickSortArray, n);
-            quickSortWrapper(quickSortArray, n);
+int randomIndex(int left, int right) {
+    unsigned int r = (unsigned int)rand() * ((unsigned int)RAND_MAX + 1u) + (unsigned int)rand();
+    return left + (int)(r % (unsigned int)(right - left + 1));
+}
 
-            printf("Quicksort: \n");
-            for (int i = 0; i < n; i++) {
-                printf("%d ", quickSortArray[i]);
+void threeWayPartition(int a[], int left, int right, int pivot, int& lt, int& gt, Operation compare, Operation assign) {
+    lt = left;
+    gt = right;
+    int i = left;
+    while (i <= gt) {
+        compare.count();
+        if (a[i] < pivot) {
+            assign.count(3);
+            swap(a[lt], a[i]);
+            lt++;
+            i++;
+        } else {
+            compare.count();
+            if (a[i] > pivot) {
+                assign.count(3);
+                swap(a[i], a[gt]);
+                gt--;
+            } else {
+                i++;
             }
-            printf("\n");
-            break;
         }
-        case HEAPSORT: {
-            int heapSortArray[n];
+    }
+}
 
-            populateArray(a, heapSortArray, n);
-            heapSort(heapSortArray, n);
+void introSelect(int a[], int left, int right, int k, int badAllowed, Operation compare, Operation assign);
 
-            printf("Heapsort: \n");
-            for (int i = 0; i < n; i++) {
-                printf("%d ", heapSortArray[i]);
-            }
-            printf("\n");
-            break;
-        }
-        case HYBRID_QUICKSORT: {
-            int hybridQuickSortArray[n];
+int medianOfMedians(int a[], int left, int right, Operation compare, Operation assign) {
+    int nrMedians = 0;
+    for (int i = left; i <= right; i += 5) {
+        int groupSize = right - i + 1 < 5 ? right - i + 1 : 5;
+        insertionSort(a + i, groupSize, compare, assign);
+        assign.count(3);
+        swap(a[left + nrMedians], a[i + groupSize / 2]);
+        nrMedians++;
+    }
 
-            populateArray(a, hybridQuickSortArray, n);
-            hybridQuickSortWrapper(hybridQuickSortArray, n, OPTIMAL_THRESHOLD);
+    int middle = left + (nrMedians - 1) / 2;
+    introSelect(a, left, left + nrMedians - 1, middle, 0, compare, assign);
+    return a[middle];
+}
 
-            printf("Hybrid Quicksort: \n");
-            for (int i = 0; i < n; i++) {
-                printf("%d ", hybridQuickSortArray[i]);
-            }
-            printf("\n");
-        
-            break;
+void introSelect(int a[], int left, int right, int k, int badAllowed, Operation compare, Operation assign) {
+    while (right - left + 1 > MAX_NETWORK_SIZE) {
+        int size = right - left + 1;
+        int pivot;
+        if (badAllowed > 0) {
+            pivot = a[randomIndex(left, right)];
+        } else {
+            pivot = medianOfMedians(a, left, right, compare, assign);
         }
-        case QUICKSELECT: {
-            int quickSelectArray[n];
 
-            populateArray(a, quickSelectArray, n);
-            quickSelect(quickSelectArray, 0, n - 1);
+        int lt, gt;
+        threeWayPartition(a, left, right, pivot, lt, gt, compare, assign);
+        if (k < lt) {
+            right = lt - 1;
+        } else if (k > gt) {
+            left = gt + 1;
+        } else {
+            return;
+        }
 
-            printf("QuickSelect: \n");
-            for (int i = 0; i < n; i++) {
-                printf("%d ", quickSelectArray[i]);
-            }
-            printf("\n");
-        
-            break;
+        if (right - left + 1 > size - size / 4 && badAllowed > 0) {
+            badAllowed--;
         }
-        default:
-            break;
+    }
+    if (left < right) {
+        hybridBaseCase(a + left, right - left + 1, compare, assign);
     }
 }
 
-void demo_all() {
-    demo(QUICKSORT);
-    demo(HEAPSORT);
-    demo(HYBRID_QUICKSORT);
-    demo(QUICKSELECT);
+int floorLog2(int n) {
+    int log = 0;
+    while (n > 1) {
+        n >>= 1;
+        log++;
+    }
+    return log;
 }
 
-void perf(int algorithm, int order) {
-    int* a = new int[MAX_SIZE];
-    int n;
-    for (n = STEP_SIZE; n <= MAX_SIZE; n += STEP_SIZE) {
-        for (int i = 0; i < m; i++) {
-            if (order == UNSORTED) {
-                FillRandomArray(a, n, 10, 50000, false, order);
-            } else {
-                FillRandomArray(a, n, 10, 50000, true, order);
-            }
-            switch (algorithm) {
-                case QUICKSORT: {
-                    int* quickSortArray = new int[n];
+int select(int a[], int n, int k, Operation compare, Operation assign) {
+    introSelect(a, 0, n - 1, k, floorLog2(n), compare, assign);
+    return a[k];
+}
 
-                    populateArray(a, quickSortArray, n);
-                    if (order == ASCENDING) {
-                        generateBestCaseQuickSort(quickSortArray, 0, n - 1);
-                    }
-                    quickSortWrapper(quickSortArray, n);
+void partialSortTopK(int a[], int n, int k, Operation compare, Operation assign) {
+    if (k <= 0) {
+        return;
+    }
+    if (k < n) {
+        select(a, n, k - 1, compare, assign);
+    } else {
+        k = n;
+    }
+    floydHeapSort(a, k, compare, assign);
+}
 
-                    if ((order == UNSORTED) && (temp > 4)) {
-                        int* quickSortArrayTime = new int[n];
-                        p.startTimer("quicksort-time", n);
-                        for (int j = 0; j < NR_TESTS; j++) {
-                            populateArray(a, quickSortArrayTime, n);
-                            quickSortWrapper(quickSortArrayTime, n);
-                        }
-                        p.stopTimer("quicksort-time", n);
-                        delete[] quickSortArrayTime;
-                    }  
-                    delete[] quickSortArray;
-                    break;
-                }
-                case HEAPSORT: {
-                    int* heapSortArray = new int[n];
+void multiSelect(int a[], int left, int right, int ks[], int first, int last, Operation compare, Operation assign) {
+    while (first <= last && ks[first] < left) {
+        first++;
+    }
+    while (first <= last && ks[last] > right) {
+        last--;
+    }
+    if (first > last || left >= right) {
+        return;
+    }
 
-                    populateArray(a, heapSortArray, n);
-                    heapSort(heapSortArray, n);
+    int middle = first + (last - first) / 2;
+    int k = ks[middle];
+    introSelect(a, left, right, k, floorLog2(right - left + 1), compare, assign);
+    multiSelect(a, left, k - 1, ks, first, middle - 1, compare, assign);
+    multiSelect(a, k + 1, right, ks, middle + 1, last, compare, assign);
+}
 
-                    delete[] heapSortArray;
-                    break;
-                }
-                case HYBRID_QUICKSORT: {
-                    int* hybridQuickSortArray = new int[n];
+void selectMany(int a[], int n, int ks[], int nrKs, Operation compare, Operation assign) {
+    int sortedKs[nrKs];
+    populateArray(ks, sortedKs, nrKs);
+    hybridSort(sortedKs, sortedKs + nrKs);
+    multiSelect(a, 0, n - 1, sortedKs, 0, nrKs - 1, compare, assign);
+}
 
-                    populateArray(a, hybridQuickSortArray, n);
-                    hybridQuickSortWrapper(hybridQuickSortArray, n, OPTIMAL_THRESHOLD);
+int selectWrapper(int a[], int n, int k) {
+    Operation selectCompare = p.createOperation("introselect-comparisons", n);
+    Operation selectAssign = p.createOperation("introselect-assignments", n);
 
-                    p.startTimer("hybrid-quicksort-time", n);
-                    for (int j = 0; j < NR_TESTS; j++) {
-                        populateArray(a, hybridQuickSortArray, n);
-                        hybridQuickSortWrapper(hybridQuickSortArray, n, OPTIMAL_THRESHOLD);
-                    }
-                    p.stopTimer("hybrid-quicksort-time", n);
+    return select(a, n, k, selectCompare, selectAssign);
+}
 
-                    delete[] hybridQuickSortArray;
-                    break;
-                }
-                default:
-                    break;
+#ifdef SIMD_SORT_AVAILABLE
+int SIMD_COMPRESS_TABLE[256][8];
+bool simdCompressTableBuilt = false;
+
+void buildSimdCompressTable() {
+    for (int mask = 0; mask < 256; mask++) {
+        int k = 0;
+        for (int lane = 0; lane < 8; lane++) {
+            if (!(mask & (1 << lane))) {
+                SIMD_COMPRESS_TABLE[mask][k++] = lane;
+            }
+        }
+        for (int lane = 0; lane < 8; lane++) {
+            if (mask & (1 << lane)) {
+                SIMD_COMPRESS_TABLE[mask][k++] = lane;
             }
         }
     }
-    temp++;
-    delete[] a;
-    switch (algorithm) {
-        case QUICKSORT: {
-            p.divideValues("quicksort-comparisons", m);
-            p.divideValues("quicksort-assignments", m);
-            p.addSeries("quicksort-total", "quicksort-comparisons", "quicksort-assignments");
+    simdCompressTableBuilt = true;
+}
 
-            p.createGroup("Quicksort Operations", "quicksort-comparisons", "quicksort-assignments", "quicksort-total");
-            break;
-        }
-        case HEAPSORT: {
-            p.divideValues("heapsort-comparisons", m);
-            p.divideValues("heapsort-assignments", m);
-            p.addSeries("heapsort-total", "heapsort-comparisons", "heapsort-assignments");
+SIMD_TARGET inline __m256i simdCompareExchange(__m256i v, __m256i partner, int upperLanes) {
+    __m256i other = _mm256_permutevar8x32_epi32(v, partner);
+    __m256i smaller = _mm256_min_epi32(v, other);
+    __m256i larger = _mm256_max_epi32(v, other);
+    switch (upperLanes) {
+        case 0xAA:
+            return _mm256_blend_epi32(smaller, larger, 0xAA);
+        case 0xCC:
+            return _mm256_blend_epi32(smaller, larger, 0xCC);
+        default:
+            return _mm256_blend_epi32(smaller, larger, 0xF0);
+    }
+}
 
-            p.createGroup("Heapsort Operations", "heapsort-comparisons", "heapsort-assignments", "heapsort-total");
-            break;
-        }
-        case HYBRID_QUICKSORT: {
-            p.divideValues("hybrid-quicksort-comparisons", m);
-            p.divideValues("hybrid-quicksort-assignments", m);
-            p.addSeries("hybrid-quicksort-total", "hybrid-quicksort-comparisons", "hybrid-quicksort-assignments");
+SIMD_TARGET inline __m256i simdBitonicSort8(__m256i v) {
+    const __m256i swap1 = _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6);
+    const __m256i swap2 = _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5);
+    const __m256i flip4 = _mm256_setr_epi32(3, 2, 1, 0, 7, 6, 5, 4);
+    const __m256i flip8 = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+    v = simdCompareExchange(v, swap1, 0xAA);
+    v = simdCompareExchange(v, flip4, 0xCC);
+    v = simdCompareExchange(v, swap1, 0xAA);
+    v = simdCompareExchange(v, flip8, 0xF0);
+    v = simdCompareExchange(v, swap2, 0xCC);
+    v = simdCompareExchange(v, swap1, 0xAA);
+    return v;
+}
 
-            p.createGroup("Hybrid Quicksort Operations", "hybrid-quicksort-comparisons", "hybrid-quicksort-assignments", "hybrid-quicksort-total");
-            break;
-        }
-        default:
-            break;
+SIMD_TARGET inline __m256i simdBitonicClean8(__m256i v) {
+    const __m256i swap1 = _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6);
+    const __m256i swap2 = _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5);
+    const __m256i swap4 = _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3);
+
+    v = simdCompareExchange(v, swap4, 0xF0);
+    v = simdCompareExchange(v, swap2, 0xCC);
+    v = simdCompareExchange(v, swap1, 0xAA);
+    return v;
+}
+
+SIMD_TARGET void simdSortSmall(int a[], int n, Operation compare, Operation assign) {
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i flip8 = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m256i infinity = _mm256_set1_epi32(INT_MAX);
+
+    if (n <= 8) {
+        __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(n), lanes);
+        __m256i v = _mm256_blendv_epi8(infinity, _mm256_maskload_epi32(a, mask), mask);
+        compare.count(6 * 4);
+        assign.count(6 * 8);
+        _mm256_maskstore_epi32(a, mask, simdBitonicSort8(v));
+        return;
     }
+
+    __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(n - 8), lanes);
+    __m256i low = simdBitonicSort8(_mm256_loadu_si256((const __m256i*)a));
+    __m256i high = simdBitonicSort8(_mm256_blendv_epi8(infinity, _mm256_maskload_epi32(a + 8, mask), mask));
+    high = _mm256_permutevar8x32_epi32(high, flip8);
+    __m256i smaller = simdBitonicClean8(_mm256_min_epi32(low, high));
+    __m256i larger = simdBitonicClean8(_mm256_max_epi32(low, high));
+    compare.count(2 * 6 * 4 + 4 + 2 * 3 * 4);
+    assign.count(2 * (2 * 6 * 4 + 4 + 2 * 3 * 4));
+    _mm256_storeu_si256((__m256i*)a, smaller);
+    _mm256_maskstore_epi32(a + 8, mask, larger);
 }
 
-void analyzeHybridThreshold() {
-    int* hybridQuickSortArray = new int[MAX_SIZE];
+SIMD_TARGET inline void simdPartitionVector(int a[], __m256i v, __m256i pivot, bool equalGoesRight, int& writeLeft, int& writeRight) {
+    __m256i right = equalGoesRight ? _mm256_xor_si256(_mm256_cmpgt_epi32(pivot, v), _mm256_set1_epi32(-1)) : _mm256_cmpgt_epi32(v, pivot);
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(right));
+    int nrRight = __builtin_popcount(mask);
+    __m256i permuted = _mm256_permutevar8x32_epi32(v, _mm256_loadu_si256((const __m256i*)SIMD_COMPRESS_TABLE[mask]));
+    _mm256_storeu_si256((__m256i*)(a + writeLeft), permuted);
+    _mm256_storeu_si256((__m256i*)(a + writeRight - 8), permuted);
+    writeLeft += 8 - nrRight;
+    writeRight -= nrRight;
+}
 
-    for (int threshold = 5; threshold <= MAX_THRESHOLD; threshold++) {
-        Operation hybridQuickSortThresholdCompare = p.createOperation("hybrid-quicksort-threshold-comparisons", threshold);
-        Operation hybridQuickSortThresholdAssign = p.createOperation("hybrid-quicksort-threshold-assignments", threshold);
-        for (int i = 0; i < NR_TESTS; i++) {
-            FillRandomArray(hybridQuickSortArray, MAX_SIZE, 10, 50000, false, UNSORTED);
-            hybridQuickSort(hybridQuickSortArray, 0, MAX_SIZE - 1, threshold, hybridQuickSortThresholdCompare, hybridQuickSortThresholdAssign);
+SIMD_TARGET int simdPartition(int a[], int n, int pivotValue, bool equalGoesRight, Operation compare, Operation assign) {
+    __m256i pivot = _mm256_set1_epi32(pivotValue);
+    __m256i savedLeft = _mm256_loadu_si256((const __m256i*)a);
+    __m256i savedRight = _mm256_loadu_si256((const __m256i*)(a + n - 8));
+    int readLeft = 8;
+    int readRight = n - 8;
+    int writeLeft = 0;
+    int writeRight = n;
+
+    while (readRight - readLeft >= 8) {
+        __m256i v;
+        if (readLeft - writeLeft <= writeRight - readRight) {
+            v = _mm256_loadu_si256((const __m256i*)(a + readLeft));
+            readLeft += 8;
+        } else {
+            readRight -= 8;
+            v = _mm256_loadu_si256((const __m256i*)(a + readRight));
         }
+        simdPartitionVector(a, v, pivot, equalGoesRight, writeLeft, writeRight);
     }
-    delete[] hybridQuickSortArray;
-    p.divideValues("hybrid-quicksort-threshold-comparisons", NR_TESTS);
-    p.divideValues("hybrid-quicksort-threshold-assignments", NR_TESTS);
-    
-    p.addSeries("hybrid-quicksort-threshold-total", "hybrid-quicksort-threshold-comparisons", "hybrid-quicksort-threshold-assignments");
-    p.createGroup("Hybrid Quicksort Threshold Analysis", "hybrid-quicksort-threshold-comparisons", "hybrid-quicksort-threshold-assignments", "hybrid-quicksort-threshold-total");
+
+    int rest[24];
+    int nrRest = 16;
+    _mm256_storeu_si256((__m256i*)rest, savedLeft);
+    _mm256_storeu_si256((__m256i*)(rest + 8), savedRight);
+    while (readLeft < readRight) {
+        rest[nrRest++] = a[readLeft++];
+    }
+    for (int i = 0; i < nrRest; i++) {
+        bool right = equalGoesRight ? rest[i] >= pivotValue : rest[i] > pivotValue;
+        if (right) {
+            a[--writeRight] = rest[i];
+        } else {
+            a[writeLeft++] = rest[i];
+        }
+    }
+
+    compare.count(n);
+    assign.count(n);
+    return writeLeft;
 }
 
-void perfAnalysis(int testMode) {
+int medianOfThreeValue(int x, int y, int z) {
+    if (x > y) {
+        swap(x, y);
+    }
+    if (y > z) {
+        y = z;
+    }
+    return x > y ? x : y;
+}
+
+SIMD_TARGET void simdQuickSort(int a[], int n, int depthLimit, Operation compare, Operation assign) {
+    while (n > SIMD_BASE_CASE) {
+        if (depthLimit-- == 0) {
+            floydHeapSort(a, n, compare, assign);
+            return;
+        }
+
+        compare.count(3);
+        int pivot = medianOfThreeValue(a[0], a[n / 2], a[n - 1]);
+        int middle = simdPartition(a, n, pivot, false, compare, assign);
+        if (middle == n) {
+            n = simdPartition(a, n, pivot, true, compare, assign);
+            continue;
+        }
+
+        if (middle < n - middle) {
+            simdQuickSort(a, middle, depthLimit, compare, assign);
+            a += middle;
+            n -= middle;
+        } else {
+            simdQuickSort(a + middle, n - middle, depthLimit, compare, assign);
+            n = middle;
+        }
+    }
+    if (n > 1) {
+        simdSortSmall(a, n, compare, assign);
+    }
+}
+#endif
+
+bool simdSortSupported() {
+#ifdef SIMD_SORT_AVAILABLE
+    static bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+void simdSort(int a[], int n, Operation compare, Operation assign) {
+#ifdef SIMD_SORT_AVAILABLE
+    if (simdSortSupported()) {
+        if (!simdCompressTableBuilt) {
+            buildSimdCompressTable();
+        }
+        int depthLimit = 2;
+        for (int size = n; size > 1; size >>= 1) {
+            depthLimit += 2;
+        }
+        simdQuickSort(a, n, depthLimit, compare, assign);
+        return;
+    }
+#endif
+    hybridQuickSort(a, 0, n - 1, hybridThreshold, compare, assign);
+}
+
+void simdSortWrapper(int a[], int n) {
+    Operation simdSortCompare = p.createOperation("simd-sort-comparisons", n);
+    Operation simdSortAssign = p.createOperation("simd-sort-assignments", n);
+
+    simdSort(a, n, simdSortCompare, simdSortAssign);
+}
+
+unsigned int radixKey(int x) {
+    return (unsigned int)x ^ 0x80000000u;
+}
+
+void radixSort(int a[], int n, Operation assign) {
+    if (n < 2) {
+        return;
+    }
+
+    int count[RADIX_PASSES][RADIX_BUCKETS] = {};
+    for (int i = 0; i < n; i++) {
+        unsigned int key = radixKey(a[i]);
+        for (int pass = 0; pass < RADIX_PASSES; pass++) {
+            count[pass][(key >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1)]++;
+        }
+    }
+
+    int* buffer = new int[n];
+    int* src = a;
+    int* dest = buffer;
+    unsigned int firstKey = radixKey(a[0]);
+
+    for (int pass = 0; pass < RADIX_PASSES; pass++) {
+        int shift = pass * RADIX_BITS;
+        if (count[pass][(firstKey >> shift) & (RADIX_BUCKETS - 1)] == n) {
+            continue;
+        }
+
+        int offset[RADIX_BUCKETS];
+        int sum = 0;
+        for (int d = 0; d < RADIX_BUCKETS; d++) {
+            offset[d] = sum;
+            sum += count[pass][d];
+        }
+
+        for (int i = 0; i < n; i++) {
+            assign.count();
+            dest[offset[(radixKey(src[i]) >> shift) & (RADIX_BUCKETS - 1)]++] = src[i];
+        }
+
+        int* t = src;
+        src = dest;
+        dest = t;
+    }
+
+    if (src != a) {
+        assign.count(n);
+        memcpy(a, src, n * sizeof(int));
+    }
+    delete[] buffer;
+}
+
+void radixSortWrapper(int a[], int n) {
+    p.createOperation("radixsort-comparisons", n);
+    Operation radixSortAssign = p.createOperation("radixsort-assignments", n);
+
+    radixSort(a, n, radixSortAssign);
+}
+
+void sort3(int a[], int i, int j, int k, Operation compare, Operation assign) {
+    compare.count();
+    if (a[j] < a[i]) {
+        assign.count(3);
+        swap(a[i], a[j]);
+    }
+    compare.count();
+    if (a[k] < a[j]) {
+        assign.count(3);
+        swap(a[j], a[k]);
+        compare.count();
+        if (a[j] < a[i]) {
+            assign.count(3);
+            swap(a[i], a[j]);
+        }
+    }
+}
+
+bool partialInsertionSort(int a[], int left, int right, Operation compare, Operation assign) {
+    int moves = 0;
+    for (int i = left + 1; i <= right; i++) {
+        compare.count();
+        if (a[i] < a[i - 1]) {
+            assign.count();
+            int key = a[i];
+            int j = i;
+            do {
+                assign.count();
+                a[j] = a[j - 1];
+                j--;
+                if (j == left) {
+                    break;
+                }
+                compare.count();
+            } while (key < a[j - 1]);
+            assign.count();
+            a[j] = key;
+            moves += i - j;
+            if (moves > PARTIAL_INSERTION_LIMIT) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int partitionRight(int a[], int left, int right, bool &alreadyPartitioned, Operation compare, Operation assign) {
+    assign.count();
+    int pivot = a[left];
+    int first = left;
+    int last = right + 1;
+
+    do {
+        first++;
+        compare.count();
+    } while (a[first] < pivot);
+
+    if (first - 1 == left) {
+        while (first < last) {
+            last--;
+            compare.count();
+            if (a[last] < pivot) {
+                break;
+            }
+        }
+    } else {
+        do {
+            last--;
+            compare.count();
+        } while (!(a[last] < pivot));
+    }
+
+    alreadyPartitioned = first >= last;
+
+    while (first < last) {
+        assign.count(3);
+        swap(a[first], a[last]);
+        do {
+            first++;
+            compare.count();
+        } while (a[first] < pivot);
+        do {
+            last--;
+            compare.count();
+        } while (!(a[last] < pivot));
+    }
+
+    int pivotIndex = first - 1;
+    assign.count(2);
+    a[left] = a[pivotIndex];
+    a[pivotIndex] = pivot;
+    return pivotIndex;
+}
+
+int partitionLeft(int a[], int left, int right, Operation compare, Operation assign) {
+    assign.count();
+    int pivot = a[left];
+    int first = left;
+    int last = right + 1;
+
+    do {
+        last--;
+        compare.count();
+    } while (pivot < a[last]);
+
+    if (last + 1 == right + 1) {
+        while (first < last) {
+            first++;
+            compare.count();
+            if (pivot < a[first]) {
+                break;
+            }
+        }
+    } else {
+        do {
+            first++;
+            compare.count();
+        } while (!(pivot < a[first]));
+    }
+
+    while (first < last) {
+        assign.count(3);
+        swap(a[first], a[last]);
+        do {
+            last--;
+            compare.count();
+        } while (pivot < a[last]);
+        do {
+            first++;
+            compare.count();
+        } while (!(pivot < a[first]));
+    }
+
+    assign.count(2);
+    a[left] = a[last];
+    a[last] = pivot;
+    return last;
+}
+
+void adaptiveQuickSort(int a[], int left, int right, int threshold, int badAllowed, bool leftmost, Operation compare, Operation assign) {
+    while (true) {
+        int size = right - left + 1;
+        if (size <= threshold) {
+            hybridBaseCase(a + left, size, compare, assign);
+            return;
+        }
+
+        int mid = left + size / 2;
+        if (size > NINTHER_THRESHOLD) {
+            sort3(a, left, mid, right, compare, assign);
+            sort3(a, left + 1, mid - 1, right - 1, compare, assign);
+            sort3(a, left + 2, mid + 1, right - 2, compare, assign);
+            sort3(a, mid - 1, mid, mid + 1, compare, assign);
+            assign.count(3);
+            swap(a[left], a[mid]);
+        } else {
+            sort3(a, mid, left, right, compare, assign);
+        }
+
+        if (!leftmost) {
+            compare.count();
+            if (!(a[left - 1] < a[left])) {
+                left = partitionLeft(a, left, right, compare, assign) + 1;
+                continue;
+            }
+        }
+
+        bool alreadyPartitioned;
+        int pivotIndex = partitionRight(a, left, right, alreadyPartitioned, compare, assign);
+
+        int leftSize = pivotIndex - left;
+        int rightSize = right - pivotIndex;
+
+        if (leftSize < size / 8 || rightSize < size / 8) {
+            badAllowed--;
+            if (badAllowed == 0) {
+                floydHeapSort(a + left, size, compare, assign);
+                return;
+            }
+
+            if (leftSize >= threshold) {
+                assign.count(6);
+                swap(a[left], a[left + leftSize / 4]);
+                swap(a[pivotIndex - 1], a[pivotIndex - leftSize / 4]);
+                if (leftSize > NINTHER_THRESHOLD) {
+                    assign.count(12);
+                    swap(a[left + 1], a[left + leftSize / 4 + 1]);
+                    swap(a[left + 2], a[left + leftSize / 4 + 2]);
+                    swap(a[pivotIndex - 2], a[pivotIndex - leftSize / 4 - 1]);
+                    swap(a[pivotIndex - 3], a[pivotIndex - leftSize / 4 - 2]);
+                }
+            }
+            if (rightSize >= threshold) {
+                assign.count(6);
+                swap(a[pivotIndex + 1], a[pivotIndex + 1 + rightSize / 4]);
+                swap(a[right], a[right - rightSize / 4]);
+                if (rightSize > NINTHER_THRESHOLD) {
+                    assign.count(12);
+                    swap(a[pivotIndex + 2], a[pivotIndex + 2 + rightSize / 4]);
+                    swap(a[pivotIndex + 3], a[pivotIndex + 3 + rightSize / 4]);
+                    swap(a[right - 1], a[right - 1 - rightSize / 4]);
+                    swap(a[right - 2], a[right - 2 - rightSize / 4]);
+                }
+            }
+        } else if (alreadyPartitioned) {
+            if (partialInsertionSort(a, left, pivotIndex - 1, compare, assign) &&
+                partialInsertionSort(a, pivotIndex + 1, right, compare, assign)) {
+                return;
+            }
+        }
+
+        adaptiveQuickSort(a, left, pivotIndex - 1, threshold, badAllowed, leftmost, compare, assign);
+        left = pivotIndex + 1;
+        leftmost = false;
+    }
+}
+
+void adaptiveSort(int a[], int n, Operation compare, Operation assign) {
+    if (n < 2) {
+        return;
+    }
+
+    int ascending = 1;
+    int descending = 1;
+    for (int i = 1; i < n && (ascending == i || descending == i); i++) {
+        compare.count();
+        if (a[i - 1] <= a[i]) {
+            ascending++;
+        }
+        if (a[i - 1] >= a[i]) {
+            descending++;
+        }
+    }
+    if (ascending == n) {
+        return;
+    }
+    if (descending == n) {
+        for (int i = 0, j = n - 1; i < j; i++, j--) {
+            assign.count(3);
+            swap(a[i], a[j]);
+        }
+        return;
+    }
+
+    int badAllowed = 1;
+    while ((n >> badAllowed) > 0) {
+        badAllowed++;
+    }
+    adaptiveQuickSort(a, 0, n - 1, hybridThreshold, badAllowed, true, compare, assign);
+}
+
+void adaptiveSortWrapper(int a[], int n) {
+    Operation adaptiveSortCompare = p.createOperation("adaptive-sort-comparisons", n);
+    Operation adaptiveSortAssign = p.createOperation("adaptive-sort-assignments", n);
+
+    adaptiveSort(a, n, adaptiveSortCompare, adaptiveSortAssign);
+}
+
+int minRunLength(int n) {
+    int r = 0;
+    while (n >= MIN_MERGE) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+int countRunAndMakeAscending(int a[], int left, int n, Operation compare, Operation assign) {
+    int runEnd = left + 1;
+    if (runEnd == n) {
+        return 1;
+    }
+
+    compare.count();
+    if (a[runEnd++] < a[left]) {
+        while (runEnd < n) {
+            compare.count();
+            if (!(a[runEnd] < a[runEnd - 1])) {
+                break;
+            }
+            runEnd++;
+        }
+        for (int i = left, j = runEnd - 1; i < j; i++, j--) {
+            assign.count(3);
+            swap(a[i], a[j]);
+        }
+    } else {
+        while (runEnd < n) {
+            compare.count();
+            if (a[runEnd] < a[runEnd - 1]) {
+                break;
+            }
+            runEnd++;
+        }
+    }
+    return runEnd - left;
+}
+
+int gallopLeft(int key, int a[], int base, int len, int hint, Operation compare) {
+    int lastOfs = 0;
+    int ofs = 1;
+
+    compare.count();
+    if (key > a[base + hint]) {
+        int maxOfs = len - hint;
+        while (ofs < maxOfs) {
+            compare.count();
+            if (!(key > a[base + hint + ofs])) {
+                break;
+            }
+            lastOfs = ofs;
+            ofs = (ofs << 1) + 1;
+            if (ofs <= 0) {
+                ofs = maxOfs;
+            }
+        }
+        if (ofs > maxOfs) {
+            ofs = maxOfs;
+        }
+        lastOfs += hint;
+        ofs += hint;
+    } else {
+        int maxOfs = hint + 1;
+        while (ofs < maxOfs) {
+            compare.count();
+            if (key > a[base + hint - ofs]) {
+                break;
+            }
+            lastOfs = ofs;
+            ofs = (ofs << 1) + 1;
+            if (ofs <= 0) {
+                ofs = maxOfs;
+            }
+        }
+        if (ofs > maxOfs) {
+            ofs = maxOfs;
+        }
+        int t = lastOfs;
+        lastOfs = hint - ofs;
+        ofs = hint - t;
+    }
+
+    lastOfs++;
+    while (lastOfs < ofs) {
+        int mid = lastOfs + (ofs - lastOfs) / 2;
+        compare.count();
+        if (key > a[base + mid]) {
+            lastOfs = mid + 1;
+        } else {
+            ofs = mid;
+        }
+    }
+    return ofs;
+}
+
+int gallopRight(int key, int a[], int base, int len, int hint, Operation compare) {
+    int lastOfs = 0;
+    int ofs = 1;
+
+    compare.count();
+    if (key < a[base + hint]) {
+        int maxOfs = hint + 1;
+        while (ofs < maxOfs) {
+            compare.count();
+            if (!(key < a[base + hint - ofs])) {
+                break;
+            }
+            lastOfs = ofs;
+            ofs = (ofs << 1) + 1;
+            if (ofs <= 0) {
+                ofs = maxOfs;
+            }
+        }
+        if (ofs > maxOfs) {
+            ofs = maxOfs;
+        }
+        int t = lastOfs;
+        lastOfs = hint - ofs;
+        ofs = hint - t;
+    } else {
+        int maxOfs = len - hint;
+        while (ofs < maxOfs) {
+            compare.count();
+            if (key < a[base + hint + ofs]) {
+                break;
+            }
+            lastOfs = ofs;
+            ofs = (ofs << 1) + 1;
+            if (ofs <= 0) {
+                ofs = maxOfs;
+            }
+        }
+        if (ofs > maxOfs) {
+            ofs = maxOfs;
+        }
+        lastOfs += hint;
+        ofs += hint;
+    }
+
+    lastOfs++;
+    while (lastOfs < ofs) {
+        int mid = lastOfs + (ofs - lastOfs) / 2;
+        compare.count();
+        if (key < a[base + mid]) {
+            ofs = mid;
+        } else {
+            lastOfs = mid + 1;
+        }
+    }
+    return ofs;
+}
+
+void mergeLo(MergeState* ms, int a[], int base1, int len1, int base2, int len2, Operation compare, Operation assign) {
+    int* tmp = ms->buffer;
+    assign.count(len1);
+    memcpy(tmp, a + base1, len1 * sizeof(int));
+
+    int cursor1 = 0;
+    int cursor2 = base2;
+    int dest = base1;
+
+    assign.count();
+    a[dest++] = a[cursor2++];
+    if (--len2 == 0) {
+        assign.count(len1);
+        memcpy(a + dest, tmp + cursor1, len1 * sizeof(int));
+        return;
+    }
+    if (len1 == 1) {
+        assign.count(len2 + 1);
+        memmove(a + dest, a + cursor2, len2 * sizeof(int));
+        a[dest + len2] = tmp[cursor1];
+        return;
+    }
+
+    int minGallop = ms->minGallop;
+    bool done = false;
+    while (!done) {
+        int count1 = 0;
+        int count2 = 0;
+
+        do {
+            compare.count();
+            assign.count();
+            if (a[cursor2] < tmp[cursor1]) {
+                a[dest++] = a[cursor2++];
+                count2++;
+                count1 = 0;
+                if (--len2 == 0) {
+                    done = true;
+                }
+            } else {
+                a[dest++] = tmp[cursor1++];
+                count1++;
+                count2 = 0;
+                if (--len1 == 1) {
+                    done = true;
+                }
+            }
+        } while (!done && (count1 | count2) < minGallop);
+
+        while (!done) {
+            count1 = gallopRight(a[cursor2], tmp, cursor1, len1, 0, compare);
+            if (count1 != 0) {
+                assign.count(count1);
+                memcpy(a + dest, tmp + cursor1, count1 * sizeof(int));
+                dest += count1;
+                cursor1 += count1;
+                len1 -= count1;
+                if (len1 <= 1) {
+                    done = true;
+                    break;
+                }
+            }
+            assign.count();
+            a[dest++] = a[cursor2++];
+            if (--len2 == 0) {
+                done = true;
+                break;
+            }
+
+            count2 = gallopLeft(tmp[cursor1], a, cursor2, len2, 0, compare);
+            if (count2 != 0) {
+                assign.count(count2);
+                memmove(a + dest, a + cursor2, count2 * sizeof(int));
+                dest += count2;
+                cursor2 += count2;
+                len2 -= count2;
+                if (len2 == 0) {
+                    done = true;
+                    break;
+                }
+            }
+            assign.count();
+            a[dest++] = tmp[cursor1++];
+            if (--len1 == 1) {
+                done = true;
+                break;
+            }
+
+            minGallop--;
+            if (count1 < MIN_GALLOP && count2 < MIN_GALLOP) {
+                break;
+            }
+        }
+        if (minGallop < 0) {
+            minGallop = 0;
+        }
+        minGallop += 2;
+    }
+    ms->minGallop = minGallop < 1 ? 1 : minGallop;
+
+    if (len1 == 1) {
+        assign.count(len2 + 1);
+        memmove(a + dest, a + cursor2, len2 * sizeof(int));
+        a[dest + len2] = tmp[cursor1];
+    } else {
+        assign.count(len1);
+        memcpy(a + dest, tmp + cursor1, len1 * sizeof(int));
+    }
+}
+
+void mergeHi(MergeState* ms, int a[], int base1, int len1, int base2, int len2, Operation compare, Operation assign) {
+    int* tmp = ms->buffer;
+    assign.count(len2);
+    memcpy(tmp, a + base2, len2 * sizeof(int));
+
+    int cursor1 = base1 + len1 - 1;
+    int cursor2 = len2 - 1;
+    int dest = base2 + len2 - 1;
+
+    assign.count();
+    a[dest--] = a[cursor1--];
+    if (--len1 == 0) {
+        assign.count(len2);
+        memcpy(a + dest - (len2 - 1), tmp, len2 * sizeof(int));
+        return;
+    }
+    if (len2 == 1) {
+        dest -= len1;
+        cursor1 -= len1;
+        assign.count(len1 + 1);
+        memmove(a + dest + 1, a + cursor1 + 1, len1 * sizeof(int));
+        a[dest] = tmp[cursor2];
+        return;
+    }
+
+    int minGallop = ms->minGallop;
+    bool done = false;
+    while (!done) {
+        int count1 = 0;
+        int count2 = 0;
+
+        do {
+            compare.count();
+            assign.count();
+            if (tmp[cursor2] < a[cursor1]) {
+                a[dest--] = a[cursor1--];
+                count1++;
+                count2 = 0;
+                if (--len1 == 0) {
+                    done = true;
+                }
+            } else {
+                a[dest--] = tmp[cursor2--];
+                count2++;
+                count1 = 0;
+                if (--len2 == 1) {
+                    done = true;
+                }
+            }
+        } while (!done && (count1 | count2) < minGallop);
+
+        while (!done) {
+            count1 = len1 - gallopRight(tmp[cursor2], a, base1, len1, len1 - 1, compare);
+            if (count1 != 0) {
+                dest -= count1;
+                cursor1 -= count1;
+                len1 -= count1;
+                assign.count(count1);
+                memmove(a + dest + 1, a + cursor1 + 1, count1 * sizeof(int));
+                if (len1 == 0) {
+                    done = true;
+                    break;
+                }
+            }
+            assign.count();
+            a[dest--] = tmp[cursor2--];
+            if (--len2 == 1) {
+                done = true;
+                break;
+            }
+
+            count2 = len2 - gallopLeft(a[cursor1], tmp, 0, len2, len2 - 1, compare);
+            if (count2 != 0) {
+                dest -= count2;
+                cursor2 -= count2;
+                len2 -= count2;
+                assign.count(count2);
+                memcpy(a + dest + 1, tmp + cursor2 + 1, count2 * sizeof(int));
+                if (len2 <= 1) {
+                    done = true;
+                    break;
+                }
+            }
+            assign.count();
+            a[dest--] = a[cursor1--];
+            if (--len1 == 0) {
+                done = true;
+                break;
+            }
+
+            minGallop--;
+            if (count1 < MIN_GALLOP && count2 < MIN_GALLOP) {
+                break;
+            }
+        }
+        if (minGallop < 0) {
+            minGallop = 0;
+        }
+        minGallop += 2;
+    }
+    ms->minGallop = minGallop < 1 ? 1 : minGallop;
+
+    if (len2 == 1) {
+        dest -= len1;
+        cursor1 -= len1;
+        assign.count(len1 + 1);
+        memmove(a + dest + 1, a + cursor1 + 1, len1 * sizeof(int));
+        a[dest] = tmp[cursor2];
+    } else {
+        assign.count(len2);
+        memcpy(a + dest - (len2 - 1), tmp, len2 * sizeof(int));
+    }
+}
+
+void mergeAt(MergeState* ms, int a[], int i, Operation compare, Operation assign) {
+    int base1 = ms->runBase[i];
+    int len1 = ms->runLength[i];
+    int base2 = ms->runBase[i + 1];
+    int len2 = ms->runLength[i + 1];
+
+    ms->runLength[i] = len1 + len2;
+    if (i == ms->stackSize - 3) {
+        ms->runBase[i + 1] = ms->runBase[i + 2];
+        ms->runLength[i + 1] = ms->runLength[i + 2];
+    }
+    ms->stackSize--;
+
+    int k = gallopRight(a[base2], a, base1, len1, 0, compare);
+    base1 += k;
+    len1 -= k;
+    if (len1 == 0) {
+        return;
+    }
+
+    len2 = gallopLeft(a[base1 + len1 - 1], a, base2, len2, len2 - 1, compare);
+    if (len2 == 0) {
+        return;
+    }
+
+    if (len1 <= len2) {
+        mergeLo(ms, a, base1, len1, base2, len2, compare, assign);
+    } else {
+        mergeHi(ms, a, base1, len1, base2, len2, compare, assign);
+    }
+}
+
+void mergeCollapse(MergeState* ms, int a[], Operation compare, Operation assign) {
+    int* len = ms->runLength;
+    while (ms->stackSize > 1) {
+        int i = ms->stackSize - 2;
+        if ((i > 0 && len[i - 1] <= len[i] + len[i + 1]) || (i > 1 && len[i - 2] <= len[i - 1] + len[i])) {
+            if (len[i - 1] < len[i + 1]) {
+                i--;
+            }
+        } else if (len[i] > len[i + 1]) {
+            break;
+        }
+        mergeAt(ms, a, i, compare, assign);
+    }
+}
+
+void mergeForceCollapse(MergeState* ms, int a[], Operation compare, Operation assign) {
+    while (ms->stackSize > 1) {
+        int i = ms->stackSize - 2;
+        if (i > 0 && ms->runLength[i - 1] < ms->runLength[i + 1]) {
+            i--;
+        }
+        mergeAt(ms, a, i, compare, assign);
+    }
+}
+
+void naturalMergeSort(int a[], int n, Operation compare, Operation assign) {
+    if (n < 2) {
+        return;
+    }
+
+    if (n < MIN_MERGE) {
+        int runLength = countRunAndMakeAscending(a, 0, n, compare, assign);
+        insertionSortFrom(a, n, runLength, compare, assign);
+        return;
+    }
+
+    MergeState ms;
+    ms.buffer = new int[n / 2 + 1];
+    ms.minGallop = MIN_GALLOP;
+    ms.stackSize = 0;
+
+    int minRun = minRunLength(n);
+    int left = 0;
+    int remaining = n;
+    while (remaining > 0) {
+        int runLength = countRunAndMakeAscending(a, left, n, compare, assign);
+        if (runLength < minRun) {
+            int force = remaining <= minRun ? remaining : minRun;
+            insertionSortFrom(a + left, force, runLength, compare, assign);
+            runLength = force;
+        }
+
+        ms.runBase[ms.stackSize] = left;
+        ms.runLength[ms.stackSize] = runLength;
+        ms.stackSize++;
+        mergeCollapse(&ms, a, compare, assign);
+
+        left += runLength;
+        remaining -= runLength;
+    }
+    mergeForceCollapse(&ms, a, compare, assign);
+
+    delete[] ms.buffer;
+}
+
+void naturalMergeSortWrapper(int a[], int n) {
+    Operation mergeSortCompare = p.createOperation("merge-sort-comparisons", n);
+    Operation mergeSortAssign = p.createOperation("merge-sort-assignments", n);
+
+    naturalMergeSort(a, n, mergeSortCompare, mergeSortAssign);
+}
+
+int lowerBound(int a[], int left, int right, int key) {
+    while (left < right) {
+        int mid = left + (right - left) / 2;
+        if (a[mid] < key) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+    return left;
+}
+
+int upperBound(int a[], int left, int right, int key) {
+    while (left < right) {
+        int mid = left + (right - left) / 2;
+        if (a[mid] <= key) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+    return left;
+}
+
+void multiwaySplit(int a[], int runStart[], int runEnd[], int k, int rank, int split[]) {
+    long long low = 0;
+    long long high = -1;
+    bool empty = true;
+    for (int i = 0; i < k; i++) {
+        if (runStart[i] < runEnd[i]) {
+            if (empty || a[runStart[i]] < low) {
+                low = a[runStart[i]];
+            }
+            if (empty || a[runEnd[i] - 1] > high) {
+                high = a[runEnd[i] - 1];
+            }
+            empty = false;
+        }
+    }
+
+    while (low < high) {
+        long long mid = low + (high - low) / 2;
+        int countLessOrEqual = 0;
+        for (int i = 0; i < k; i++) {
+            countLessOrEqual += upperBound(a, runStart[i], runEnd[i], (int)mid) - runStart[i];
+        }
+        if (countLessOrEqual > rank) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+
+    int value = (int)low;
+    int remaining = rank;
+    for (int i = 0; i < k; i++) {
+        split[i] = empty ? runStart[i] : lowerBound(a, runStart[i], runEnd[i], value);
+        remaining -= split[i] - runStart[i];
+    }
+    for (int i = 0; i < k && remaining > 0; i++) {
+        int equal = empty ? 0 : upperBound(a, split[i], runEnd[i], value) - split[i];
+        int take = equal < remaining ? equal : remaining;
+        split[i] += take;
+        remaining -= take;
+    }
+}
+
+void runHeapify(int heap[], int size, int i, int a[], int cursor[], Operation compare, Operation assign) {
+    while (true) {
+        int smallest = i;
+        int l = 2 * i + 1;
+        int r = 2 * i + 2;
+
+        if (l < size) {
+            compare.count();
+            if (a[cursor[heap[l]]] < a[cursor[heap[smallest]]]) {
+                smallest = l;
+            }
+        }
+        if (r < size) {
+            compare.count();
+            if (a[cursor[heap[r]]] < a[cursor[heap[smallest]]]) {
+                smallest = r;
+            }
+        }
+        if (smallest == i) {
+            return;
+        }
+        assign.count(3);
+        swap(heap[i], heap[smallest]);
+        i = smallest;
+    }
+}
+
+void multiwayMerge(int a[], int runStart[], int runEnd[], int k, int out[], Operation compare, Operation assign) {
+    int cursor[MAX_THREADS];
+    int heap[MAX_THREADS];
+    int size = 0;
+
+    for (int i = 0; i < k; i++) {
+        cursor[i] = runStart[i];
+        if (runStart[i] < runEnd[i]) {
+            heap[size++] = i;
+        }
+    }
+    for (int i = size / 2 - 1; i >= 0; i--) {
+        runHeapify(heap, size, i, a, cursor, compare, assign);
+    }
+
+    int dest = 0;
+    while (size > 0) {
+        int run = heap[0];
+        assign.count();
+        out[dest++] = a[cursor[run]++];
+        if (cursor[run] == runEnd[run]) {
+            heap[0] = heap[--size];
+        }
+        runHeapify(heap, size, 0, a, cursor, compare, assign);
+    }
+}
+
+void parallelSortChunk(int a[], int n, bool counting, unsigned int* comparisons, unsigned int* assignments) {
+    Profiler threadProfiler;
+    Operation compare = threadProfiler.createOperation("chunk-comparisons", n);
+    Operation assign = threadProfiler.createOperation("chunk-assignments", n);
+    if (!counting) {
+        // contoarele unui Profiler sunt oprite cat timp ruleaza un cronometru al lui
+        threadProfiler.startTimer("chunk-time", n);
+    }
+
+    adaptiveSort(a, n, compare, assign);
+
+    *comparisons = compare.get();
+    *assignments = assign.get();
+}
+
+void parallelMergeSlice(int a[], int runStart[], int runEnd[], int k, int out[], bool counting, unsigned int* comparisons, unsigned int* assignments) {
+    Profiler threadProfiler;
+    Operation compare = threadProfiler.createOperation("merge-comparisons", k);
+    Operation assign = threadProfiler.createOperation("merge-assignments", k);
+    if (!counting) {
+        // contoarele unui Profiler sunt oprite cat timp ruleaza un cronometru al lui
+        threadProfiler.startTimer("merge-time", k);
+    }
+
+    multiwayMerge(a, runStart, runEnd, k, out, compare, assign);
+
+    *comparisons = compare.get();
+    *assignments = assign.get();
+}
+
+void copySlice(int dest[], int src[], int n) {
+    memcpy(dest, src, n * sizeof(int));
+}
+
+int defaultThreadCount() {
+    int nrThreads = (int)std::thread::hardware_concurrency();
+    if (nrThreads < 1) {
+        nrThreads = 1;
+    }
+    if (nrThreads > MAX_THREADS) {
+        nrThreads = MAX_THREADS;
+    }
+    return nrThreads;
+}
+
+void parallelMergeSort(int a[], int n, int nrThreads, Operation compare, Operation assign, bool counting = true) {
+    if (nrThreads > MAX_THREADS) {
+        nrThreads = MAX_THREADS;
+    }
+    if (nrThreads <= 1 || n < PARALLEL_CUTOFF) {
+        adaptiveSort(a, n, compare, assign);
+        return;
+    }
+
+    int runStart[MAX_THREADS];
+    int runEnd[MAX_THREADS];
+    unsigned int comparisons[MAX_THREADS];
+    unsigned int assignments[MAX_THREADS];
+    std::thread workers[MAX_THREADS];
+
+    for (int t = 0; t < nrThreads; t++) {
+        runStart[t] = (int)((long long)n * t / nrThreads);
+        runEnd[t] = (int)((long long)n * (t + 1) / nrThreads);
+    }
+
+    for (int t = 0; t < nrThreads; t++) {
+        workers[t] = std::thread(parallelSortChunk, a + runStart[t], runEnd[t] - runStart[t], counting, &comparisons[t], &assignments[t]);
+    }
+    for (int t = 0; t < nrThreads; t++) {
+        workers[t].join();
+        compare.count(comparisons[t]);
+        assign.count(assignments[t]);
+    }
+
+    int* split = new int[(nrThreads + 1) * nrThreads];
+    for (int t = 0; t <= nrThreads; t++) {
+        multiwaySplit(a, runStart, runEnd, nrThreads, (int)((long long)n * t / nrThreads), split + t * nrThreads);
+    }
+
+    int* buffer = new int[n];
+    for (int t = 0; t < nrThreads; t++) {
+        int out = (int)((long long)n * t / nrThreads);
+        workers[t] = std::thread(parallelMergeSlice, a, split + t * nrThreads, split + (t + 1) * nrThreads, nrThreads, buffer + out, counting, &comparisons[t], &assignments[t]);
+    }
+    for (int t = 0; t < nrThreads; t++) {
+        workers[t].join();
+        compare.count(comparisons[t]);
+        assign.count(assignments[t]);
+    }
+
+    assign.count(n);
+    for (int t = 0; t < nrThreads; t++) {
+        workers[t] = std::thread(copySlice, a + runStart[t], buffer + runStart[t], runEnd[t] - runStart[t]);
+    }
+    for (int t = 0; t < nrThreads; t++) {
+        workers[t].join();
+    }
+
+    delete[] buffer;
+    delete[] split;
+}
+
+void parallelMergeSortWrapper(int a[], int n) {
+    Operation parallelMergeSortCompare = p.createOperation("parallel-merge-sort-comparisons", n);
+    Operation parallelMergeSortAssign = p.createOperation("parallel-merge-sort-assignments", n);
+
+    parallelMergeSort(a, n, defaultThreadCount(), parallelMergeSortCompare, parallelMergeSortAssign);
+}
+
+int msdDigit(int x, int shift) {
+    return (int)((radixKey(x) >> shift) & (RADIX_BUCKETS - 1));
+}
+
+void msdRadixPermute(int a[], int head[], const int tail[], int shift, Operation assign) {
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        while (head[b] < tail[b]) {
+            int v = a[head[b]];
+            int k = msdDigit(v, shift);
+            if (k == b) {
+                head[b]++;
+                continue;
+            }
+            while (k != b) {
+                int t = a[head[k]];
+                assign.count();
+                a[head[k]++] = v;
+                v = t;
+                k = msdDigit(v, shift);
+            }
+            assign.count();
+            a[head[b]++] = v;
+        }
+    }
+}
+
+void msdRadixSortRange(int a[], int n, int shift, Operation compare, Operation assign) {
+    if (n <= MSD_RADIX_CUTOFF) {
+        hybridQuickSort(a, 0, n - 1, hybridThreshold, compare, assign);
+        return;
+    }
+
+    int count[RADIX_BUCKETS] = {};
+    for (int i = 0; i < n; i++) {
+        count[msdDigit(a[i], shift)]++;
+    }
+    if (count[msdDigit(a[0], shift)] == n) {
+        if (shift > 0) {
+            msdRadixSortRange(a, n, shift - RADIX_BITS, compare, assign);
+        }
+        return;
+    }
+
+    int head[RADIX_BUCKETS];
+    int tail[RADIX_BUCKETS];
+    int sum = 0;
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        head[b] = sum;
+        sum += count[b];
+        tail[b] = sum;
+    }
+    msdRadixPermute(a, head, tail, shift, assign);
+
+    if (shift > 0) {
+        for (int b = 0; b < RADIX_BUCKETS; b++) {
+            if (count[b] > 1) {
+                msdRadixSortRange(a + tail[b] - count[b], count[b], shift - RADIX_BITS, compare, assign);
+            }
+        }
+    }
+}
+
+void msdRadixCount(int a[], int n, int shift, int count[]) {
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        count[b] = 0;
+    }
+    for (int i = 0; i < n; i++) {
+        count[msdDigit(a[i], shift)]++;
+    }
+}
+
+void msdRadixSpeculate(int a[], int shift, int head[], int tail[], bool counting, unsigned int* assignments) {
+    Profiler threadProfiler;
+    Operation assign = threadProfiler.createOperation("speculate-assignments", RADIX_BUCKETS);
+    if (!counting) {
+        // contoarele unui Profiler sunt oprite cat timp ruleaza un cronometru al lui
+        threadProfiler.startTimer("speculate-time", RADIX_BUCKETS);
+    }
+
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        while (head[b] < tail[b]) {
+            int v = a[head[b]];
+            int k = msdDigit(v, shift);
+            if (k == b) {
+                head[b]++;
+                continue;
+            }
+            bool parked = false;
+            while (k != b) {
+                int t;
+                if (head[k] < tail[k]) {
+                    t = a[head[k]];
+                    assign.count();
+                    a[head[k]++] = v;
+                } else {
+                    tail[b]--;
+                    if (tail[b] == head[b]) {
+                        assign.count();
+                        a[head[b]] = v;
+                        parked = true;
+                        break;
+                    }
+                    t = a[tail[b]];
+                    assign.count();
+                    a[tail[b]] = v;
+                }
+                v = t;
+                k = msdDigit(v, shift);
+            }
+            if (!parked) {
+                assign.count();
+                a[head[b]++] = v;
+            }
+        }
+    }
+
+    *assignments = assign.get();
+}
+
+void msdRadixRepair(int a[], int first, int last, int nrThreads, const int stripeHead[], int* newFirst, Operation assign) {
+    int stripeStart[MAX_THREADS + 1];
+    int misplaced = 0;
+    for (int t = 0; t <= nrThreads; t++) {
+        stripeStart[t] = first + (int)((long long)(last - first) * t / nrThreads);
+    }
+    for (int t = 0; t < nrThreads; t++) {
+        misplaced += stripeStart[t + 1] - stripeHead[t * RADIX_BUCKETS];
+    }
+    int boundary = last - misplaced;
+
+    int lt = 0;
+    int lpos = stripeHead[0];
+    int rt = nrThreads - 1;
+    int rpos = stripeHead[rt * RADIX_BUCKETS] - 1;
+    while (true) {
+        while (lt < nrThreads && lpos >= stripeStart[lt + 1]) {
+            lt++;
+            if (lt < nrThreads) {
+                lpos = stripeHead[lt * RADIX_BUCKETS];
+            }
+        }
+        if (lt == nrThreads || lpos >= boundary) {
+            break;
+        }
+        while (rpos < stripeStart[rt]) {
+            rt--;
+            rpos = stripeHead[rt * RADIX_BUCKETS] - 1;
+        }
+        assign.count(3);
+        swap(a[lpos++], a[rpos--]);
+    }
+    *newFirst = boundary;
+}
+
+void msdRadixSortBuckets(int a[], const int bucketEnd[], const int count[], int firstBucket, int lastBucket, int bigBucket, int shift,
+    bool counting, unsigned int* comparisons, unsigned int* assignments) {
+    Profiler threadProfiler;
+    Operation compare = threadProfiler.createOperation("bucket-comparisons", RADIX_BUCKETS);
+    Operation assign = threadProfiler.createOperation("bucket-assignments", RADIX_BUCKETS);
+    if (!counting) {
+        // contoarele unui Profiler sunt oprite cat timp ruleaza un cronometru al lui
+        threadProfiler.startTimer("bucket-time", RADIX_BUCKETS);
+    }
+
+    for (int b = firstBucket; b < lastBucket; b++) {
+        if (count[b] > 1 && count[b] < bigBucket) {
+            msdRadixSortRange(a + bucketEnd[b] - count[b], count[b], shift, compare, assign);
+        }
+    }
+
+    *comparisons = compare.get();
+    *assignments = assign.get();
+}
+
+void msdRadixSortParallel(int a[], int n, int shift, int nrThreads, Operation compare, Operation assign, bool counting) {
+    if (nrThreads <= 1 || n < PARALLEL_CUTOFF) {
+        msdRadixSortRange(a, n, shift, compare, assign);
+        return;
+    }
+
+    int* local = new int[nrThreads * RADIX_BUCKETS];
+    int* stripeHead = new int[nrThreads * RADIX_BUCKETS];
+    int* stripeTail = new int[nrThreads * RADIX_BUCKETS];
+    unsigned int comparisons[MAX_THREADS];
+    unsigned int assignments[MAX_THREADS];
+    std::thread workers[MAX_THREADS];
+
+    for (int t = 0; t < nrThreads; t++) {
+        int from = (int)((long long)n * t / nrThreads);
+        int to = (int)((long long)n * (t + 1) / nrThreads);
+        workers[t] = std::thread(msdRadixCount, a + from, to - from, shift, local + t * RADIX_BUCKETS);
+    }
+    int count[RADIX_BUCKETS] = {};
+    for (int t = 0; t < nrThreads; t++) {
+        workers[t].join();
+        for (int b = 0; b < RADIX_BUCKETS; b++) {
+            count[b] += local[t * RADIX_BUCKETS + b];
+        }
+    }
+
+    if (count[msdDigit(a[0], shift)] == n) {
+        delete[] local;
+        delete[] stripeHead;
+        delete[] stripeTail;
+        if (shift > 0) {
+            msdRadixSortParallel(a, n, shift - RADIX_BITS, nrThreads, compare, assign, counting);
+        }
+        return;
+    }
+
+    int head[RADIX_BUCKETS];
+    int tail[RADIX_BUCKETS];
+    int sum = 0;
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        head[b] = sum;
+        sum += count[b];
+        tail[b] = sum;
+    }
+
+    int remaining = n;
+    while (remaining >= PARALLEL_CUTOFF) {
+        for (int t = 0; t < nrThreads; t++) {
+            for (int b = 0; b < RADIX_BUCKETS; b++) {
+                int length = tail[b] - head[b];
+                stripeHead[t * RADIX_BUCKETS + b] = head[b] + (int)((long long)length * t / nrThreads);
+                stripeTail[t * RADIX_BUCKETS + b] = head[b] + (int)((long long)length * (t + 1) / nrThreads);
+            }
+        }
+        for (int t = 0; t < nrThreads; t++) {
+            workers[t] = std::thread(msdRadixSpeculate, a, shift, stripeHead + t * RADIX_BUCKETS, stripeTail + t * RADIX_BUCKETS, counting,
+                &assignments[t]);
+        }
+        for (int t = 0; t < nrThreads; t++) {
+            workers[t].join();
+            assign.count(assignments[t]);
+        }
+
+        int left = 0;
+        for (int b = 0; b < RADIX_BUCKETS; b++) {
+            if (head[b] < tail[b]) {
+                msdRadixRepair(a, head[b], tail[b], nrThreads, stripeHead + b, &head[b], assign);
+                left += tail[b] - head[b];
+            }
+        }
+        if (left == remaining) {
+            break;
+        }
+        remaining = left;
+    }
+    msdRadixPermute(a, head, tail, shift, assign);
+
+    delete[] local;
+    delete[] stripeHead;
+    delete[] stripeTail;
+    if (shift == 0) {
+        return;
+    }
+
+    int bigBucket = n / nrThreads > PARALLEL_CUTOFF ? n / nrThreads : PARALLEL_CUTOFF;
+    long long smallTotal = 0;
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        if (count[b] < bigBucket) {
+            smallTotal += count[b];
+        }
+    }
+
+    int firstBucket[MAX_THREADS + 1];
+    int t = 0;
+    long long acc = 0;
+    firstBucket[0] = 0;
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        if (count[b] < bigBucket) {
+            acc += count[b];
+        }
+        while (t + 1 < nrThreads && acc * nrThreads >= smallTotal * (t + 1)) {
+            firstBucket[++t] = b + 1;
+        }
+    }
+    while (t < nrThreads) {
+        firstBucket[++t] = RADIX_BUCKETS;
+    }
+
+    for (t = 0; t < nrThreads; t++) {
+        workers[t] = std::thread(msdRadixSortBuckets, a, tail, count, firstBucket[t], firstBucket[t + 1], bigBucket, shift - RADIX_BITS,
+            counting, &comparisons[t], &assignments[t]);
+    }
+    for (t = 0; t < nrThreads; t++) {
+        workers[t].join();
+        compare.count(comparisons[t]);
+        assign.count(assignments[t]);
+    }
+
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        if (count[b] >= bigBucket) {
+            msdRadixSortParallel(a + tail[b] - count[b], count[b], shift - RADIX_BITS, nrThreads, compare, assign, counting);
+        }
+    }
+}
+
+void msdRadixSort(int a[], int n, int nrThreads, Operation compare, Operation assign, bool counting = true) {
+    if (nrThreads > MAX_THREADS) {
+        nrThreads = MAX_THREADS;
+    }
+    if (n < 2) {
+        return;
+    }
+    msdRadixSortParallel(a, n, 32 - RADIX_BITS, nrThreads, compare, assign, counting);
+}
+
+void msdRadixSortWrapper(int a[], int n) {
+    Operation msdRadixSortCompare = p.createOperation("msd-radix-sort-comparisons", n);
+    Operation msdRadixSortAssign = p.createOperation("msd-radix-sort-assignments", n);
+
+    msdRadixSort(a, n, defaultThreadCount(), msdRadixSortCompare, msdRadixSortAssign);
+}
+
+FILE* openBuffered(const char* name, const char* mode) {
+    FILE* f = fopen(name, mode);
+    if (f != NULL) {
+        setvbuf(f, NULL, _IOFBF, EXTERNAL_IO_BUFFER);
+    }
+    return f;
+}
+
+void runFileName(char name[], int size, const char* outputFile, int pass, int index) {
+    snprintf(name, size, "%s.pass%d.run%d", outputFile, pass, index);
+}
+
+int refillRun(FILE* run, int buffer[], int bufferSize, int start) {
+    return start + (int)fread(buffer + start, sizeof(int), bufferSize, run);
+}
+
+bool mergeRunFiles(FILE* runs[], int k, FILE* out, int memory[], int memorySize, Operation compare, Operation assign) {
+    int bufferSize = memorySize / (k + 1);
+    int* outBuffer = memory + k * bufferSize;
+    int cursor[EXTERNAL_MAX_FANIN];
+    int runEnd[EXTERNAL_MAX_FANIN];
+    int heap[EXTERNAL_MAX_FANIN];
+    int size = 0;
+
+    for (int i = 0; i < k; i++) {
+        cursor[i] = i * bufferSize;
+        runEnd[i] = refillRun(runs[i], memory, bufferSize, cursor[i]);
+        if (ferror(runs[i])) {
+            return false;
+        }
+        if (cursor[i] < runEnd[i]) {
+            heap[size++] = i;
+        }
+    }
+    for (int i = size / 2 - 1; i >= 0; i--) {
+        runHeapify(heap, size, i, memory, cursor, compare, assign);
+    }
+
+    int dest = 0;
+    while (size > 0) {
+        int run = heap[0];
+        assign.count();
+        outBuffer[dest++] = memory[cursor[run]++];
+        if (dest == bufferSize) {
+            if (fwrite(outBuffer, sizeof(int), dest, out) != (size_t)dest) {
+                return false;
+            }
+            dest = 0;
+        }
+        if (cursor[run] == runEnd[run]) {
+            cursor[run] = run * bufferSize;
+            runEnd[run] = refillRun(runs[run], memory, bufferSize, cursor[run]);
+            if (ferror(runs[run])) {
+                return false;
+            }
+            if (cursor[run] == runEnd[run]) {
+                heap[0] = heap[--size];
+            }
+        }
+        runHeapify(heap, size, 0, memory, cursor, compare, assign);
+    }
+    return fwrite(outBuffer, sizeof(int), dest, out) == (size_t)dest;
+}
+
+bool mergeRunGroup(const char* outputFile, int pass, int first, int k, const char* destination, int memory[], int memorySize, Operation compare, Operation assign) {
+    FILE* runs[EXTERNAL_MAX_FANIN];
+    char name[MAX_FILE_NAME];
+    bool ok = true;
+
+    FILE* out = openBuffered(destination, "wb");
+    if (out == NULL) {
+        printf("Could not write %s\n", destination);
+        return false;
+    }
+    for (int i = 0; i < k; i++) {
+        runFileName(name, sizeof(name), outputFile, pass, first + i);
+        runs[i] = fopen(name, "rb");
+        if (runs[i] == NULL) {
+            printf("Could not read %s\n", name);
+            ok = false;
+        }
+    }
+
+    if (ok && !mergeRunFiles(runs, k, out, memory, memorySize, compare, assign)) {
+        printf("Could not merge runs into %s\n", destination);
+        ok = false;
+    }
+
+    for (int i = 0; i < k; i++) {
+        if (runs[i] != NULL) {
+            fclose(runs[i]);
+        }
+        runFileName(name, sizeof(name), outputFile, pass, first + i);
+        remove(name);
+    }
+    if (fclose(out) != 0) {
+        ok = false;
+    }
+    return ok;
+}
+
+bool externalSort(const char* inputFile, const char* outputFile, int chunkSize, int nrThreads, Operation compare, Operation assign,
+    bool counting = true) {
+    if (chunkSize < 1) {
+        chunkSize = 1;
+    }
+    int memorySize = chunkSize > EXTERNAL_MAX_FANIN + 1 ? chunkSize : EXTERNAL_MAX_FANIN + 1;
+
+    FILE* in = openBuffered(inputFile, "rb");
+    if (in == NULL) {
+        printf("Could not read %s\n", inputFile);
+        return false;
+    }
+
+    int* memory = new int[memorySize];
+    char name[MAX_FILE_NAME];
+    int nrRuns = 0;
+    bool ok = true;
+
+    int count;
+    while (ok && (count = (int)fread(memory, sizeof(int), chunkSize, in)) > 0) {
+        parallelMergeSort(memory, count, nrThreads, compare, assign, counting);
+
+        runFileName(name, sizeof(name), outputFile, 0, nrRuns);
+        FILE* run = openBuffered(name, "wb");
+        if (run == NULL || fwrite(memory, sizeof(int), count, run) != (size_t)count) {
+            printf("Could not write %s\n", name);
+            ok = false;
+        }
+        if (run != NULL && fclose(run) != 0) {
+            ok = false;
+        }
+        nrRuns++;
+    }
+    if (ferror(in)) {
+        printf("Could not read %s\n", inputFile);
+        ok = false;
+    }
+    fclose(in);
+
+    int pass = 0;
+    while (ok && nrRuns > EXTERNAL_MAX_FANIN) {
+        int nrMerged = 0;
+        for (int first = 0; first < nrRuns; first += EXTERNAL_MAX_FANIN) {
+            int k = nrRuns - first < EXTERNAL_MAX_FANIN ? nrRuns - first : EXTERNAL_MAX_FANIN;
+            runFileName(name, sizeof(name), outputFile, pass + 1, nrMerged);
+            if (ok) {
+                ok = mergeRunGroup(outputFile, pass, first, k, name, memory, memorySize, compare, assign);
+            } else {
+                for (int i = 0; i < k; i++) {
+                    runFileName(name, sizeof(name), outputFile, pass, first + i);
+                    remove(name);
+                }
+            }
+            nrMerged++;
+        }
+        nrRuns = nrMerged;
+        pass++;
+    }
+
+    if (ok) {
+        ok = mergeRunGroup(outputFile, pass, 0, nrRuns, outputFile, memory, memorySize, compare, assign);
+    } else {
+        for (int i = 0; i < nrRuns; i++) {
+            runFileName(name, sizeof(name), outputFile, pass, i);
+            remove(name);
+        }
+    }
+
+    delete[] memory;
+    return ok;
+}
+
+bool writeIntFile(const char* name, int a[], int n) {
+    FILE* f = openBuffered(name, "wb");
+    if (f == NULL) {
+        printf("Could not write %s\n", name);
+        return false;
+    }
+    bool ok = fwrite(a, sizeof(int), n, f) == (size_t)n;
+    return fclose(f) == 0 && ok;
+}
+
+bool readIntFile(const char* name, int a[], int n) {
+    FILE* f = openBuffered(name, "rb");
+    if (f == NULL) {
+        printf("Could not read %s\n", name);
+        return false;
+    }
+    bool ok = fread(a, sizeof(int), n, f) == (size_t)n;
+    fclose(f);
+    return ok;
+}
+
+void genericHybridSortWrapper(int a[], int n) {
+    Operation genericSortCompare = p.createOperation("generic-sort-comparisons", n);
+    Operation genericSortAssign = p.createOperation("generic-sort-assignments", n);
+
+    hybridSort(a, a + n, IdentityKey(), KeyLess(), &genericSortCompare, &genericSortAssign);
+}
+
+void cpuModel(char model[], int size) {
+    snprintf(model, size, "unknown-cpu");
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    unsigned int brand[12];
+    if (__get_cpuid(0x80000000, &brand[0], &brand[1], &brand[2], &brand[3]) && brand[0] >= 0x80000004) {
+        for (unsigned int leaf = 0; leaf < 3; leaf++) {
+            __get_cpuid(0x80000002 + leaf, &brand[4 * leaf], &brand[4 * leaf + 1], &brand[4 * leaf + 2], &brand[4 * leaf + 3]);
+        }
+        char name[49];
+        memcpy(name, brand, 48);
+        name[48] = '\0';
+
+        int start = 0;
+        while (name[start] == ' ') {
+            start++;
+        }
+        snprintf(model, size, "%s", name + start);
+    }
+#endif
+    for (int i = 0; model[i] != '\0'; i++) {
+        if (model[i] == '|' || model[i] == ' ' || model[i] == '\n') {
+            model[i] = '_';
+        }
+    }
+}
+
+const char* baseCaseName(void (*baseCase)(int[], int, Operation, Operation)) {
+    return baseCase == insertionSort ? "insertion" : "network";
+}
+
+long long timeHybridQuickSort(int a[], int sortArray[], int n, int threshold, void (*baseCase)(int[], int, Operation, Operation)) {
+    Profiler tuningProfiler;
+    Operation dummyCounter = tuningProfiler.createOperation("tuning-counter", n);
+    void (*previousBaseCase)(int[], int, Operation, Operation) = hybridBaseCase;
+    hybridBaseCase = baseCase;
+
+    long long best = -1;
+    for (int i = 0; i < TUNING_REPEATS; i++) {
+        populateArray(a, sortArray, n);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        hybridQuickSort(sortArray, 0, n - 1, threshold, dummyCounter, dummyCounter);
+        long long elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        if (best < 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    hybridBaseCase = previousBaseCase;
+    return best;
+}
+
+bool loadHybridTuning() {
+    FILE* f = fopen(TUNING_CACHE_FILE, "r");
+    if (f == NULL) {
+        return false;
+    }
+
+    char model[MAX_LINE];
+    cpuModel(model, sizeof(model));
+
+    char line[MAX_LINE];
+    char lineModel[MAX_LINE];
+    char lineType[MAX_LINE];
+    char lineBaseCase[MAX_LINE];
+    int lineThreshold;
+    bool found = false;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        if (sscanf(line, "%255[^|]|%255[^|]|%d|%255s", lineModel, lineType, &lineThreshold, lineBaseCase) != 4) {
+            continue;
+        }
+        if (strcmp(lineModel, model) == 0 && strcmp(lineType, "int") == 0 && lineThreshold > 0) {
+            hybridThreshold = lineThreshold;
+            hybridBaseCase = strcmp(lineBaseCase, "insertion") == 0 ? insertionSort : sortingNetworkSort;
+            found = true;
+        }
+    }
+    fclose(f);
+    return found;
+}
+
+void saveHybridTuning() {
+    char model[MAX_LINE];
+    cpuModel(model, sizeof(model));
+
+    char kept[16][MAX_LINE];
+    int nrKept = 0;
+    FILE* f = fopen(TUNING_CACHE_FILE, "r");
+    if (f != NULL) {
+        char line[MAX_LINE];
+        char lineModel[MAX_LINE];
+        char lineType[MAX_LINE];
+        while (fgets(line, sizeof(line), f) != NULL && nrKept < 16) {
+            if (sscanf(line, "%255[^|]|%255[^|]|", lineModel, lineType) != 2) {
+                continue;
+            }
+            if (strcmp(lineModel, model) != 0 || strcmp(lineType, "int") != 0) {
+                snprintf(kept[nrKept++], MAX_LINE, "%s", line);
+            }
+        }
+        fclose(f);
+    }
+
+    f = fopen(TUNING_CACHE_FILE, "w");
+    if (f == NULL) {
+        printf("Could not write %s\n", TUNING_CACHE_FILE);
+        return;
+    }
+    for (int i = 0; i < nrKept; i++) {
+        fputs(kept[i], f);
+    }
+    fprintf(f, "%s|int|%d|%s\n", model, hybridThreshold, baseCaseName(hybridBaseCase));
+    fclose(f);
+}
+
+void calibrateHybrid() {
+    int thresholds[] = {8, 12, 16, 24, 32, 48};
+    int nrThresholds = sizeof(thresholds) / sizeof(thresholds[0]);
+    void (*baseCases[])(int[], int, Operation, Operation) = {insertionSort, sortingNetworkSort};
+
+    int* a = new int[TUNING_SIZE];
+    int* sortArray = new int[TUNING_SIZE];
+    FillRandomArray(a, TUNING_SIZE, 10, 50000, false, UNSORTED);
+
+    long long bestTime = -1;
+    for (int i = 0; i < nrThresholds; i++) {
+        for (int j = 0; j < 2; j++) {
+            if (baseCases[j] == sortingNetworkSort && thresholds[i] > MAX_NETWORK_SIZE) {
+                continue;
+            }
+            long long elapsed = timeHybridQuickSort(a, sortArray, TUNING_SIZE, thresholds[i], baseCases[j]);
+            printf("threshold %2d, %-9s base case: %lld us\n", thresholds[i], baseCaseName(baseCases[j]), elapsed);
+            if (bestTime < 0 || elapsed < bestTime) {
+                bestTime = elapsed;
+                hybridThreshold = thresholds[i];
+                hybridBaseCase = baseCases[j];
+            }
+        }
+    }
+    delete[] a;
+    delete[] sortArray;
+
+    printf("Calibrated hybrid quicksort: threshold %d, %s base case\n", hybridThreshold, baseCaseName(hybridBaseCase));
+    saveHybridTuning();
+}
+
+void demo(int algorithm) {
+    int a[] = {64, 34, 25, 12, 22, 11, 90};
+    int n = sizeof(a)/sizeof(a[0]);
+
+    switch (algorithm) {
+        case QUICKSORT: {
+            int quickSortArray[n];
+
+            populateArray(a, quickSortArray, n);
+            quickSortWrapper(quickSortArray, n);
+
+            printf("Quicksort: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", quickSortArray[i]);
+            }
+            printf("\n");
+            break;
+        }
+        case HEAPSORT: {
+            int heapSortArray[n];
+
+            populateArray(a, heapSortArray, n);
+            heapSort(heapSortArray, n);
+
+            printf("Heapsort: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", heapSortArray[i]);
+            }
+            printf("\n");
+            break;
+        }
+        case FLOYD_HEAPSORT: {
+            int floydHeapSortArray[n];
+
+            populateArray(a, floydHeapSortArray, n);
+            floydHeapSortWrapper(floydHeapSortArray, n);
+
+            printf("Floyd Heapsort: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", floydHeapSortArray[i]);
+            }
+            printf("\n");
+            break;
+        }
+        case DARY_HEAPSORT: {
+            int daryHeapSortArray[n];
+
+            populateArray(a, daryHeapSortArray, n);
+            daryHeapSortWrapper(daryHeapSortArray, n);
+
+            printf("D-ary Heapsort: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", daryHeapSortArray[i]);
+            }
+            printf("\n");
+            break;
+        }
+        case SIMD_SORT: {
+            int simdSortArray[n];
+
+            populateArray(a, simdSortArray, n);
+            simdSortWrapper(simdSortArray, n);
+
+            printf("SIMD Sort (%s): \n", simdSortSupported() ? "AVX2" : "scalar fallback");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", simdSortArray[i]);
+            }
+            printf("\n");
+            break;
+        }
+        case HYBRID_QUICKSORT: {
+            int hybridQuickSortArray[n];
+
+            populateArray(a, hybridQuickSortArray, n);
+            hybridQuickSortWrapper(hybridQuickSortArray, n, hybridThreshold);
+
+            printf("Hybrid Quicksort: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", hybridQuickSortArray[i]);
+            }
+            printf("\n");
+        
+            break;
+        }
+        case QUICKSELECT: {
+            int quickSelectArray[n];
+
+            populateArray(a, quickSelectArray, n);
+            quickSelect(quickSelectArray, 0, n - 1);
+
+            printf("QuickSelect: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", quickSelectArray[i]);
+            }
+            printf("\n");
+        
+            break;
+        }
+        case RADIX_SORT: {
+            int radixSortArray[n];
+
+            populateArray(a, radixSortArray, n);
+            radixSortWrapper(radixSortArray, n);
+
+            printf("Radix Sort: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", radixSortArray[i]);
+            }
+            printf("\n");
+
+            break;
+        }
+        case MSD_RADIX_SORT: {
+            int msdRadixSortArray[n];
+
+            populateArray(a, msdRadixSortArray, n);
+            msdRadixSortWrapper(msdRadixSortArray, n);
+
+            printf("MSD Radix Sort: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", msdRadixSortArray[i]);
+            }
+            printf("\n");
+
+            break;
+        }
+        case ADAPTIVE_SORT: {
+            int adaptiveSortArray[n];
+
+            populateArray(a, adaptiveSortArray, n);
+            adaptiveSortWrapper(adaptiveSortArray, n);
+
+            printf("Adaptive Sort: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", adaptiveSortArray[i]);
+            }
+            printf("\n");
+
+            break;
+        }
+        case NATURAL_MERGESORT: {
+            int mergeSortArray[n];
+
+            populateArray(a, mergeSortArray, n);
+            naturalMergeSortWrapper(mergeSortArray, n);
+
+            printf("Natural Merge Sort: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", mergeSortArray[i]);
+            }
+            printf("\n");
+
+            break;
+        }
+        case PARALLEL_MERGESORT: {
+            int parallelMergeSortArray[n];
+
+            populateArray(a, parallelMergeSortArray, n);
+            parallelMergeSortWrapper(parallelMergeSortArray, n);
+
+            printf("Parallel Merge Sort: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", parallelMergeSortArray[i]);
+            }
+            printf("\n");
+
+            break;
+        }
+        case GENERIC_HYBRID_SORT: {
+            int genericSortArray[n];
+
+            populateArray(a, genericSortArray, n);
+            genericHybridSortWrapper(genericSortArray, n);
+
+            printf("Generic Hybrid Sort: \n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", genericSortArray[i]);
+            }
+            printf("\n");
+
+            break;
+        }
+        case INTROSELECT: {
+            int selectArray[n];
+            Operation dummyCounter = p.createOperation("dummy-counter", n);
+
+            populateArray(a, selectArray, n);
+            printf("Introselect (median): %d\n", selectWrapper(selectArray, n, n / 2));
+
+            int ks[] = {0, n / 4, n / 2, 3 * n / 4, n - 1};
+            int nrKs = sizeof(ks) / sizeof(ks[0]);
+            populateArray(a, selectArray, n);
+            selectMany(selectArray, n, ks, nrKs, dummyCounter, dummyCounter);
+            printf("Quartiles (select many): ");
+            for (int i = 0; i < nrKs; i++) {
+                printf("%d ", selectArray[ks[i]]);
+            }
+            printf("\n");
+
+            int k = 3;
+            populateArray(a, selectArray, n);
+            partialSortTopK(selectArray, n, k, dummyCounter, dummyCounter);
+            printf("Top %d smallest: ", k);
+            for (int i = 0; i < k; i++) {
+                printf("%d ", selectArray[i]);
+            }
+            printf("\n");
+
+            FillRandomArray(selectArray, n, 10, 50000, false, ASCENDING);
+            partialSortTopK(selectArray, n, n / 2, dummyCounter, dummyCounter);
+            printf("Top %d smallest (ascending input): ", n / 2);
+            for (int i = 0; i < n / 2; i++) {
+                printf("%d ", selectArray[i]);
+            }
+            printf("\n");
+
+            break;
+        }
+        case EXTERNAL_SORT: {
+            int externalSortArray[n];
+            Operation dummyCounter = p.createOperation("dummy-counter", n);
+
+            if (writeIntFile("external-demo-input.bin", a, n)
+                && externalSort("external-demo-input.bin", "external-demo-output.bin", 3, defaultThreadCount(), dummyCounter, dummyCounter)
+                && readIntFile("external-demo-output.bin", externalSortArray, n)) {
+                printf("External Merge Sort: \n");
+                for (int i = 0; i < n; i++) {
+                    printf("%d ", externalSortArray[i]);
+                }
+                printf("\n");
+            }
+            remove("external-demo-input.bin");
+            remove("external-demo-output.bin");
+
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void demo_all() {
+    demo(QUICKSORT);
+    demo(HEAPSORT);
+    demo(FLOYD_HEAPSORT);
+    demo(DARY_HEAPSORT);
+    demo(SIMD_SORT);
+    demo(HYBRID_QUICKSORT);
+    demo(QUICKSELECT);
+    demo(RADIX_SORT);
+    demo(MSD_RADIX_SORT);
+    demo(ADAPTIVE_SORT);
+    demo(NATURAL_MERGESORT);
+    demo(PARALLEL_MERGESORT);
+    demo(GENERIC_HYBRID_SORT);
+    demo(INTROSELECT);
+    demo(EXTERNAL_SORT);
+}
+
+void perf(int algorithm, int order) {
+    int* a = new int[MAX_SIZE];
+    int n;
+    for (n = STEP_SIZE; n <= MAX_SIZE; n += STEP_SIZE) {
+        for (int i = 0; i < m; i++) {
+            if (order == ORGAN_PIPE) {
+                fillOrganPipe(a, n);
+            } else if (order == UNSORTED) {
+                FillRandomArray(a, n, 10, 50000, false, order);
+            } else {
+                FillRandomArray(a, n, 10, 50000, true, order);
+            }
+            switch (algorithm) {
+                case QUICKSORT: {
+                    int* quickSortArray = new int[n];
+
+                    populateArray(a, quickSortArray, n);
+                    if (order == ASCENDING) {
+                        generateBestCaseQuickSort(quickSortArray, 0, n - 1);
+                    }
+                    quickSortWrapper(quickSortArray, n);
+
+                    if ((order == UNSORTED) && (temp > 4)) {
+                        int* quickSortArrayTime = new int[n];
+                        p.startTimer("quicksort-time", n);
+                        for (int j = 0; j < NR_TESTS; j++) {
+                            populateArray(a, quickSortArrayTime, n);
+                            quickSortWrapper(quickSortArrayTime, n);
+                        }
+                        p.stopTimer("quicksort-time", n);
+                        delete[] quickSortArrayTime;
+                    }  
+                    delete[] quickSortArray;
+                    break;
+                }
+                case HEAPSORT: {
+                    int* heapSortArray = new int[n];
+
+                    populateArray(a, heapSortArray, n);
+                    heapSort(heapSortArray, n);
+
+                    delete[] heapSortArray;
+                    break;
+                }
+                case FLOYD_HEAPSORT: {
+                    int* floydHeapSortArray = new int[n];
+
+                    populateArray(a, floydHeapSortArray, n);
+                    floydHeapSortWrapper(floydHeapSortArray, n);
+
+                    delete[] floydHeapSortArray;
+                    break;
+                }
+                case DARY_HEAPSORT: {
+                    int* daryHeapSortArray = new int[n];
+
+                    populateArray(a, daryHeapSortArray, n);
+                    daryHeapSortWrapper(daryHeapSortArray, n);
+
+                    delete[] daryHeapSortArray;
+                    break;
+                }
+                case SIMD_SORT: {
+                    int* simdSortArray = new int[n];
+                    Operation dummyCounter = p.createOperation("dummy-counter", n);
+
+                    populateArray(a, simdSortArray, n);
+                    simdSortWrapper(simdSortArray, n);
+
+                    p.startTimer("simd-sort-time", n);
+                    for (int j = 0; j < NR_TESTS; j++) {
+                        populateArray(a, simdSortArray, n);
+                        simdSort(simdSortArray, n, dummyCounter, dummyCounter);
+                    }
+                    p.stopTimer("simd-sort-time", n);
+
+                    delete[] simdSortArray;
+                    break;
+                }
+                case HYBRID_QUICKSORT: {
+                    int* hybridQuickSortArray = new int[n];
+
+                    populateArray(a, hybridQuickSortArray, n);
+                    hybridQuickSortWrapper(hybridQuickSortArray, n, hybridThreshold);
+
+                    p.startTimer("hybrid-quicksort-time", n);
+                    for (int j = 0; j < NR_TESTS; j++) {
+                        populateArray(a, hybridQuickSortArray, n);
+                        hybridQuickSortWrapper(hybridQuickSortArray, n, hybridThreshold);
+                    }
+                    p.stopTimer("hybrid-quicksort-time", n);
+
+                    delete[] hybridQuickSortArray;
+                    break;
+                }
+                case RADIX_SORT: {
+                    int* radixSortArray = new int[n];
+
+                    populateArray(a, radixSortArray, n);
+                    radixSortWrapper(radixSortArray, n);
+
+                    delete[] radixSortArray;
+                    break;
+                }
+                case MSD_RADIX_SORT: {
+                    int* msdRadixSortArray = new int[n];
+                    Operation dummyCounter = p.createOperation("dummy-counter", n);
+
+                    populateArray(a, msdRadixSortArray, n);
+                    msdRadixSortWrapper(msdRadixSortArray, n);
+
+                    p.startTimer("msd-radix-sort-time", n);
+                    for (int j = 0; j < NR_TESTS; j++) {
+                        populateArray(a, msdRadixSortArray, n);
+                        msdRadixSort(msdRadixSortArray, n, defaultThreadCount(), dummyCounter, dummyCounter, false);
+                    }
+                    p.stopTimer("msd-radix-sort-time", n);
+
+                    delete[] msdRadixSortArray;
+                    break;
+                }
+                case STD_BASELINES: {
+                    int* baselineArray = new int[n];
+
+                    timeStdBaselines(p, "time", a, baselineArray, n, NR_TESTS);
+
+                    delete[] baselineArray;
+                    break;
+                }
+                case ADAPTIVE_SORT: {
+                    int* adaptiveSortArray = new int[n];
+
+                    populateArray(a, adaptiveSortArray, n);
+                    adaptiveSortWrapper(adaptiveSortArray, n);
+
+                    p.startTimer("adaptive-sort-time", n);
+                    for (int j = 0; j < NR_TESTS; j++) {
+                        populateArray(a, adaptiveSortArray, n);
+                        adaptiveSortWrapper(adaptiveSortArray, n);
+                    }
+                    p.stopTimer("adaptive-sort-time", n);
+
+                    delete[] adaptiveSortArray;
+                    break;
+                }
+                case NATURAL_MERGESORT: {
+                    int* mergeSortArray = new int[n];
+
+                    populateArray(a, mergeSortArray, n);
+                    naturalMergeSortWrapper(mergeSortArray, n);
+
+                    p.startTimer("merge-sort-time", n);
+                    for (int j = 0; j < NR_TESTS; j++) {
+                        populateArray(a, mergeSortArray, n);
+                        naturalMergeSortWrapper(mergeSortArray, n);
+                    }
+                    p.stopTimer("merge-sort-time", n);
+
+                    delete[] mergeSortArray;
+                    break;
+                }
+                case GENERIC_HYBRID_SORT: {
+                    int* genericSortArray = new int[n];
+
+                    populateArray(a, genericSortArray, n);
+                    genericHybridSortWrapper(genericSortArray, n);
+
+                    p.startTimer("generic-sort-time", n);
+                    for (int j = 0; j < NR_TESTS; j++) {
+                        populateArray(a, genericSortArray, n);
+                        hybridSort(genericSortArray, genericSortArray + n);
+                    }
+                    p.stopTimer("generic-sort-time", n);
+
+                    delete[] genericSortArray;
+                    break;
+                }
+                case INTROSELECT: {
+                    int* selectArray = new int[n];
+                    Operation dummyCounter = p.createOperation("dummy-counter", n);
+
+                    populateArray(a, selectArray, n);
+                    selectWrapper(selectArray, n, n / 2);
+
+                    p.startTimer("introselect-time", n);
+                    for (int j = 0; j < NR_TESTS; j++) {
+                        populateArray(a, selectArray, n);
+                        select(selectArray, n, n / 2, dummyCounter, dummyCounter);
+                    }
+                    p.stopTimer("introselect-time", n);
+
+                    p.startTimer("partial-sort-top-k-time", n);
+                    for (int j = 0; j < NR_TESTS; j++) {
+                        populateArray(a, selectArray, n);
+                        partialSortTopK(selectArray, n, n / 2, dummyCounter, dummyCounter);
+                    }
+                    p.stopTimer("partial-sort-top-k-time", n);
+
+                    delete[] selectArray;
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+    temp++;
+    delete[] a;
+    switch (algorithm) {
+        case QUICKSORT: {
+            p.divideValues("quicksort-comparisons", m);
+            p.divideValues("quicksort-assignments", m);
+            p.addSeries("quicksort-total", "quicksort-comparisons", "quicksort-assignments");
+
+            p.createGroup("Quicksort Operations", "quicksort-comparisons", "quicksort-assignments", "quicksort-total");
+            break;
+        }
+        case HEAPSORT: {
+            p.divideValues("heapsort-comparisons", m);
+            p.divideValues("heapsort-assignments", m);
+            p.addSeries("heapsort-total", "heapsort-comparisons", "heapsort-assignments");
+
+            p.createGroup("Heapsort Operations", "heapsort-comparisons", "heapsort-assignments", "heapsort-total");
+            break;
+        }
+        case FLOYD_HEAPSORT: {
+            p.divideValues("floyd-heapsort-comparisons", m);
+            p.divideValues("floyd-heapsort-assignments", m);
+            p.addSeries("floyd-heapsort-total", "floyd-heapsort-comparisons", "floyd-heapsort-assignments");
+
+            p.createGroup("Floyd Heapsort Operations", "floyd-heapsort-comparisons", "floyd-heapsort-assignments", "floyd-heapsort-total");
+            break;
+        }
+        case DARY_HEAPSORT: {
+            p.divideValues("dary-heapsort-comparisons", m);
+            p.divideValues("dary-heapsort-assignments", m);
+            p.addSeries("dary-heapsort-total", "dary-heapsort-comparisons", "dary-heapsort-assignments");
+
+            p.createGroup("D-ary Heapsort Operations", "dary-heapsort-comparisons", "dary-heapsort-assignments", "dary-heapsort-total");
+            break;
+        }
+        case SIMD_SORT: {
+            p.divideValues("simd-sort-comparisons", m);
+            p.divideValues("simd-sort-assignments", m);
+            p.addSeries("simd-sort-total", "simd-sort-comparisons", "simd-sort-assignments");
+
+            p.createGroup("SIMD Sort Operations", "simd-sort-comparisons", "simd-sort-assignments", "simd-sort-total");
+            break;
+        }
+        case HYBRID_QUICKSORT: {
+            p.divideValues("hybrid-quicksort-comparisons", m);
+            p.divideValues("hybrid-quicksort-assignments", m);
+            p.addSeries("hybrid-quicksort-total", "hybrid-quicksort-comparisons", "hybrid-quicksort-assignments");
+
+            p.createGroup("Hybrid Quicksort Operations", "hybrid-quicksort-comparisons", "hybrid-quicksort-assignments", "hybrid-quicksort-total");
+            break;
+        }
+        case RADIX_SORT: {
+            p.divideValues("radixsort-comparisons", m);
+            p.divideValues("radixsort-assignments", m);
+            p.addSeries("radixsort-total", "radixsort-comparisons", "radixsort-assignments");
+
+            p.createGroup("Radix Sort Operations", "radixsort-comparisons", "radixsort-assignments", "radixsort-total");
+            break;
+        }
+        case MSD_RADIX_SORT: {
+            p.divideValues("msd-radix-sort-comparisons", m);
+            p.divideValues("msd-radix-sort-assignments", m);
+            p.addSeries("msd-radix-sort-total", "msd-radix-sort-comparisons", "msd-radix-sort-assignments");
+
+            p.createGroup("MSD Radix Sort Operations", "msd-radix-sort-comparisons", "msd-radix-sort-assignments", "msd-radix-sort-total");
+            break;
+        }
+        case ADAPTIVE_SORT: {
+            p.divideValues("adaptive-sort-comparisons", m);
+            p.divideValues("adaptive-sort-assignments", m);
+            p.addSeries("adaptive-sort-total", "adaptive-sort-comparisons", "adaptive-sort-assignments");
+
+            p.createGroup("Adaptive Sort Operations", "adaptive-sort-comparisons", "adaptive-sort-assignments", "adaptive-sort-total");
+            break;
+        }
+        case NATURAL_MERGESORT: {
+            p.divideValues("merge-sort-comparisons", m);
+            p.divideValues("merge-sort-assignments", m);
+            p.addSeries("merge-sort-total", "merge-sort-comparisons", "merge-sort-assignments");
+
+            p.createGroup("Natural Merge Sort Operations", "merge-sort-comparisons", "merge-sort-assignments", "merge-sort-total");
+            break;
+        }
+        case GENERIC_HYBRID_SORT: {
+            p.divideValues("generic-sort-comparisons", m);
+            p.divideValues("generic-sort-assignments", m);
+            p.addSeries("generic-sort-total", "generic-sort-comparisons", "generic-sort-assignments");
+
+            p.createGroup("Generic Hybrid Sort Operations", "generic-sort-comparisons", "generic-sort-assignments", "generic-sort-total");
+            break;
+        }
+        case INTROSELECT: {
+            p.divideValues("introselect-comparisons", m);
+            p.divideValues("introselect-assignments", m);
+            p.addSeries("introselect-total", "introselect-comparisons", "introselect-assignments");
+
+            p.createGroup("Introselect Operations", "introselect-comparisons", "introselect-assignments", "introselect-total");
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void perfLarge(int algorithm) {
+    int* a = new int[LARGE_MAX_SIZE];
+    int* sortArray = new int[LARGE_MAX_SIZE];
+    int n;
+    for (n = LARGE_STEP_SIZE; n <= LARGE_MAX_SIZE; n += LARGE_STEP_SIZE) {
+        FillRandomArray(a, n, 10, 50000, false, UNSORTED);
+        Operation dummyCounter = p.createOperation("dummy-counter", n);
+        bool verify = algorithm != INTROSELECT;
+        bool failed = false;
+
+        switch (algorithm) {
+            case HYBRID_QUICKSORT: {
+                p.startTimer("hybrid-quicksort-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    hybridQuickSort(sortArray, 0, n - 1, hybridThreshold, dummyCounter, dummyCounter);
+                }
+                p.stopTimer("hybrid-quicksort-large-time", n);
+                break;
+            }
+            case HEAPSORT: {
+                p.startTimer("heapsort-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    heapSort(sortArray, n, dummyCounter, dummyCounter);
+                }
+                p.stopTimer("heapsort-large-time", n);
+                break;
+            }
+            case FLOYD_HEAPSORT: {
+                p.startTimer("floyd-heapsort-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    floydHeapSort(sortArray, n, dummyCounter, dummyCounter);
+                }
+                p.stopTimer("floyd-heapsort-large-time", n);
+                break;
+            }
+            case DARY_HEAPSORT: {
+                p.startTimer("dary-heapsort-4-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    daryHeapSort<4>(sortArray, n);
+                }
+                p.stopTimer("dary-heapsort-4-large-time", n);
+
+                p.startTimer("dary-heapsort-8-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    daryHeapSort<8>(sortArray, n);
+                }
+                p.stopTimer("dary-heapsort-8-large-time", n);
+                break;
+            }
+            case SIMD_SORT: {
+                p.startTimer("simd-sort-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    simdSort(sortArray, n, dummyCounter, dummyCounter);
+                }
+                p.stopTimer("simd-sort-large-time", n);
+                break;
+            }
+            case RADIX_SORT: {
+                p.startTimer("radixsort-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    radixSort(sortArray, n, dummyCounter);
+                }
+                p.stopTimer("radixsort-large-time", n);
+                break;
+            }
+            case MSD_RADIX_SORT: {
+                int nrThreads = defaultThreadCount();
+                p.startTimer("msd-radix-sort-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    msdRadixSort(sortArray, n, nrThreads, dummyCounter, dummyCounter, false);
+                }
+                p.stopTimer("msd-radix-sort-large-time", n);
+                break;
+            }
+            case STD_BASELINES: {
+                timeStdBaselines(p, "large-time", a, sortArray, n, NR_LARGE_TESTS);
+                break;
+            }
+            case PARALLEL_MERGESORT: {
+                int nrThreads = defaultThreadCount();
+                p.startTimer("parallel-merge-sort-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    parallelMergeSort(sortArray, n, nrThreads, dummyCounter, dummyCounter, false);
+                }
+                p.stopTimer("parallel-merge-sort-large-time", n);
+                break;
+            }
+            case GENERIC_HYBRID_SORT: {
+                p.startTimer("generic-sort-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    hybridSort(sortArray, sortArray + n);
+                }
+                p.stopTimer("generic-sort-large-time", n);
+                break;
+            }
+            case INTROSELECT: {
+                p.startTimer("introselect-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    select(sortArray, n, n / 2, dummyCounter, dummyCounter);
+                }
+                p.stopTimer("introselect-large-time", n);
+
+                p.startTimer("partial-sort-top-k-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(a, sortArray, n);
+                    partialSortTopK(sortArray, n, n / 2, dummyCounter, dummyCounter);
+                }
+                p.stopTimer("partial-sort-top-k-large-time", n);
+
+                int* ascending = new int[n];
+                FillRandomArray(ascending, n, 10, 50000, false, ASCENDING);
+                p.startTimer("partial-sort-top-k-ascending-large-time", n);
+                for (int j = 0; j < NR_LARGE_TESTS; j++) {
+                    populateArray(ascending, sortArray, n);
+                    partialSortTopK(sortArray, n, n / 2, dummyCounter, dummyCounter);
+                }
+                p.stopTimer("partial-sort-top-k-ascending-large-time", n);
+                delete[] ascending;
+                break;
+            }
+            case EXTERNAL_SORT: {
+                int nrThreads = defaultThreadCount();
+                bool ok = writeIntFile("external-input.bin", a, n);
+                p.startTimer("external-sort-large-time", n);
+                for (int j = 0; ok && j < NR_LARGE_TESTS; j++) {
+                    ok = externalSort("external-input.bin", "external-output.bin", n / EXTERNAL_CHUNK_DIVISOR, nrThreads, dummyCounter,
+                        dummyCounter, false);
+                }
+                p.stopTimer("external-sort-large-time", n);
+                ok = ok && readIntFile("external-output.bin", sortArray, n);
+                remove("external-input.bin");
+                remove("external-output.bin");
+                if (!ok) {
+                    printf("perfLarge(%d): external sort failed for n = %d, stopping the series\n", algorithm, n);
+                    verify = false;
+                    failed = true;
+                }
+                break;
+            }
+            default:
+                verify = false;
+                break;
+        }
+
+        if (verify) {
+            char name[32];
+            snprintf(name, sizeof(name), "perfLarge(%d)", algorithm);
+            checkSorted(name, sortArray, n);
+        }
+        if (failed) {
+            break;
+        }
+    }
+    delete[] a;
+    delete[] sortArray;
+}
+
+void analyzeHybridThreshold() {
+    int* hybridQuickSortArray = new int[MAX_SIZE];
+
+    for (int threshold = 5; threshold <= MAX_THRESHOLD; threshold++) {
+        Operation hybridQuickSortThresholdCompare = p.createOperation("hybrid-quicksort-threshold-comparisons", threshold);
+        Operation hybridQuickSortThresholdAssign = p.createOperation("hybrid-quicksort-threshold-assignments", threshold);
+        for (int i = 0; i < NR_TESTS; i++) {
+            FillRandomArray(hybridQuickSortArray, MAX_SIZE, 10, 50000, false, UNSORTED);
+            hybridQuickSort(hybridQuickSortArray, 0, MAX_SIZE - 1, threshold, hybridQuickSortThresholdCompare, hybridQuickSortThresholdAssign);
+        }
+    }
+    delete[] hybridQuickSortArray;
+    p.divideValues("hybrid-quicksort-threshold-comparisons", NR_TESTS);
+    p.divideValues("hybrid-quicksort-threshold-assignments", NR_TESTS);
+    
+    p.addSeries("hybrid-quicksort-threshold-total", "hybrid-quicksort-threshold-comparisons", "hybrid-quicksort-threshold-assignments");
+    p.createGroup("Hybrid Quicksort Threshold Analysis", "hybrid-quicksort-threshold-comparisons", "hybrid-quicksort-threshold-assignments", "hybrid-quicksort-threshold-total");
+}
+
+void analyzeBaseCase() {
+    void (*tunedBaseCase)(int[], int, Operation, Operation) = hybridBaseCase;
+    int* a = new int[MAX_SIZE];
+    int* hybridQuickSortArray = new int[MAX_SIZE];
+    int n;
+    for (n = STEP_SIZE; n <= MAX_SIZE; n += STEP_SIZE) {
+        FillRandomArray(a, n, 10, 50000, false, UNSORTED);
+
+        Operation insertionBaseCompare = p.createOperation("insertion-base-comparisons", n);
+        Operation insertionBaseAssign = p.createOperation("insertion-base-assignments", n);
+        hybridBaseCase = insertionSort;
+        populateArray(a, hybridQuickSortArray, n);
+        hybridQuickSort(hybridQuickSortArray, 0, n - 1, OPTIMAL_THRESHOLD, insertionBaseCompare, insertionBaseAssign);
+
+        p.startTimer("insertion-base-time", n);
+        for (int j = 0; j < NR_TESTS; j++) {
+            populateArray(a, hybridQuickSortArray, n);
+            hybridQuickSort(hybridQuickSortArray, 0, n - 1, OPTIMAL_THRESHOLD, insertionBaseCompare, insertionBaseAssign);
+        }
+        p.stopTimer("insertion-base-time", n);
+
+        Operation networkBaseCompare = p.createOperation("network-base-comparisons", n);
+        Operation networkBaseAssign = p.createOperation("network-base-assignments", n);
+        hybridBaseCase = sortingNetworkSort;
+        populateArray(a, hybridQuickSortArray, n);
+        hybridQuickSort(hybridQuickSortArray, 0, n - 1, OPTIMAL_THRESHOLD, networkBaseCompare, networkBaseAssign);
+
+        p.startTimer("network-base-time", n);
+        for (int j = 0; j < NR_TESTS; j++) {
+            populateArray(a, hybridQuickSortArray, n);
+            hybridQuickSort(hybridQuickSortArray, 0, n - 1, OPTIMAL_THRESHOLD, networkBaseCompare, networkBaseAssign);
+        }
+        p.stopTimer("network-base-time", n);
+    }
+    hybridBaseCase = tunedBaseCase;
+    delete[] a;
+    delete[] hybridQuickSortArray;
+
+    p.addSeries("insertion-base-total", "insertion-base-comparisons", "insertion-base-assignments");
+    p.addSeries("network-base-total", "network-base-comparisons", "network-base-assignments");
+
+    p.createGroup("Base Case Comparisons", "insertion-base-comparisons", "network-base-comparisons");
+    p.createGroup("Base Case Total Operations", "insertion-base-total", "network-base-total");
+    p.createGroup("Base Case Times", "insertion-base-time", "network-base-time");
+}
+
+void perfAnalysis(int testMode) {
     switch (testMode) {
         case QUICKSORT_ANALYSIS: {
             p.reset("Quicksort Average Case Analysis");
@@ -429,9 +3319,12 @@ void perfAnalysis(int testMode) {
         case HEAPSORT_VS_QUICKSORT: {
             p.reset("Heapsort vs Quicksort - Average Case");
             perf(HEAPSORT, UNSORTED);
+            perf(FLOYD_HEAPSORT, UNSORTED);
             perf(QUICKSORT, UNSORTED);
 
             p.createGroup("Heapsort vs Quicksort", "heapsort-total", "quicksort-total");
+            p.createGroup("Heapsort vs Floyd Heapsort Comparisons", "heapsort-comparisons", "floyd-heapsort-comparisons");
+            p.createGroup("Heapsort vs Floyd Heapsort", "heapsort-total", "floyd-heapsort-total", "quicksort-total");
             break;
         }
         case HYBRID_THRESHOLD_ANALYSIS: {
@@ -443,9 +3336,218 @@ void perfAnalysis(int testMode) {
             p.reset("Quicksort vs Hybrid Quicksort - Average Case");
             perf(QUICKSORT, UNSORTED);
             perf(HYBRID_QUICKSORT, UNSORTED);
+            perf(STD_BASELINES, UNSORTED);
 
             p.createGroup("Quicksort vs Hybrid Quicksort", "quicksort-total", "hybrid-quicksort-total");
-            p.createGroup("Quicksort vs Hybrid Quicksort Times", "quicksort-time", "hybrid-quicksort-time");
+            p.createGroup("Quicksort vs Hybrid Quicksort Times", "quicksort-time", "hybrid-quicksort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+            break;
+        }
+        case RADIX_VS_HYBRID_QUICKSORT: {
+            p.reset("Radix Sort vs Hybrid Quicksort - Large Arrays");
+            perf(RADIX_SORT, UNSORTED);
+            perfLarge(RADIX_SORT);
+            perfLarge(HYBRID_QUICKSORT);
+            perfLarge(STD_BASELINES);
+
+            p.createGroup("Radix Sort vs Hybrid Quicksort Times", "radixsort-large-time", "hybrid-quicksort-large-time",
+                STD_SORT_SERIES("large-time"), STD_STABLE_SORT_SERIES("large-time"), STD_HEAP_SORT_SERIES("large-time"), STD_PAR_SORT_SERIES("large-time"));
+            break;
+        }
+        case ADAPTIVE_SORT_ANALYSIS: {
+            p.reset("Adaptive Sort vs Hybrid Quicksort - Average Case");
+            perf(ADAPTIVE_SORT, UNSORTED);
+            perf(HYBRID_QUICKSORT, UNSORTED);
+            perf(STD_BASELINES, UNSORTED);
+
+            p.createGroup("Adaptive Sort vs Hybrid Quicksort", "adaptive-sort-total", "hybrid-quicksort-total");
+            p.createGroup("Adaptive Sort vs Hybrid Quicksort Times", "adaptive-sort-time", "hybrid-quicksort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+
+            p.reset("Adaptive Sort - Best Case");
+            perf(ADAPTIVE_SORT, ASCENDING);
+            perf(STD_BASELINES, ASCENDING);
+            p.createGroup("Adaptive Sort vs Standard Library Times - Best Case", "adaptive-sort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+
+            p.reset("Adaptive Sort - Worst Case");
+            perf(ADAPTIVE_SORT, DESCENDING);
+            perf(STD_BASELINES, DESCENDING);
+            p.createGroup("Adaptive Sort vs Standard Library Times - Worst Case", "adaptive-sort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+            break;
+        }
+        case MERGESORT_ANALYSIS: {
+            p.reset("Natural Merge Sort vs Adaptive Sort - Average Case");
+            perf(NATURAL_MERGESORT, UNSORTED);
+            perf(ADAPTIVE_SORT, UNSORTED);
+            perf(STD_BASELINES, UNSORTED);
+
+            p.createGroup("Natural Merge Sort vs Adaptive Sort", "merge-sort-total", "adaptive-sort-total");
+            p.createGroup("Natural Merge Sort vs Adaptive Sort Times", "merge-sort-time", "adaptive-sort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+
+            p.reset("Natural Merge Sort - Best Case");
+            perf(NATURAL_MERGESORT, ASCENDING);
+            perf(STD_BASELINES, ASCENDING);
+            p.createGroup("Natural Merge Sort vs Standard Library Times - Best Case", "merge-sort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+
+            p.reset("Natural Merge Sort - Descending Runs");
+            perf(NATURAL_MERGESORT, DESCENDING);
+            perf(STD_BASELINES, DESCENDING);
+            p.createGroup("Natural Merge Sort vs Standard Library Times - Descending Runs", "merge-sort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+            break;
+        }
+        case PARALLEL_MERGESORT_ANALYSIS: {
+            p.reset("Parallel Merge Sort vs Hybrid Quicksort - Large Arrays");
+            perfLarge(PARALLEL_MERGESORT);
+            perfLarge(HYBRID_QUICKSORT);
+            perfLarge(STD_BASELINES);
+
+            p.createGroup("Parallel Merge Sort vs Hybrid Quicksort Times", "parallel-merge-sort-large-time", "hybrid-quicksort-large-time",
+                STD_SORT_SERIES("large-time"), STD_STABLE_SORT_SERIES("large-time"), STD_HEAP_SORT_SERIES("large-time"), STD_PAR_SORT_SERIES("large-time"));
+            break;
+        }
+        case BASE_CASE_ANALYSIS: {
+            p.reset("Hybrid Quicksort Base Case - Insertion Sort vs Sorting Networks");
+            analyzeBaseCase();
+            break;
+        }
+        case GENERIC_SORT_ANALYSIS: {
+            p.reset("Generic Hybrid Sort vs Hybrid Quicksort - Average Case");
+            perf(GENERIC_HYBRID_SORT, UNSORTED);
+            perf(HYBRID_QUICKSORT, UNSORTED);
+            perf(STD_BASELINES, UNSORTED);
+
+            p.createGroup("Generic Hybrid Sort vs Hybrid Quicksort", "generic-sort-total", "hybrid-quicksort-total");
+            p.createGroup("Generic Hybrid Sort vs Hybrid Quicksort Times", "generic-sort-time", "hybrid-quicksort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+
+            p.reset("Generic Hybrid Sort vs Hybrid Quicksort - Organ Pipe");
+            perf(GENERIC_HYBRID_SORT, ORGAN_PIPE);
+            perf(HYBRID_QUICKSORT, ORGAN_PIPE);
+            perf(STD_BASELINES, ORGAN_PIPE);
+
+            p.createGroup("Generic Hybrid Sort vs Hybrid Quicksort", "generic-sort-total", "hybrid-quicksort-total");
+            p.createGroup("Generic Hybrid Sort vs Hybrid Quicksort Times", "generic-sort-time", "hybrid-quicksort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+
+            p.reset("Generic Hybrid Sort vs Hybrid Quicksort - Large Arrays");
+            perfLarge(GENERIC_HYBRID_SORT);
+            perfLarge(HYBRID_QUICKSORT);
+            perfLarge(STD_BASELINES);
+
+            p.createGroup("Generic Hybrid Sort vs Hybrid Quicksort Large Times", "generic-sort-large-time", "hybrid-quicksort-large-time",
+                STD_SORT_SERIES("large-time"), STD_STABLE_SORT_SERIES("large-time"), STD_HEAP_SORT_SERIES("large-time"), STD_PAR_SORT_SERIES("large-time"));
+            break;
+        }
+        case SELECTION_ANALYSIS: {
+            p.reset("Introselect (median) vs Hybrid Quicksort - Average Case");
+            perf(INTROSELECT, UNSORTED);
+            perf(HYBRID_QUICKSORT, UNSORTED);
+            perf(STD_BASELINES, UNSORTED);
+
+            p.createGroup("Introselect vs Hybrid Quicksort", "introselect-total", "hybrid-quicksort-total");
+            p.createGroup("Introselect vs Hybrid Quicksort Times", "introselect-time", "hybrid-quicksort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+
+            p.reset("Introselect - Sorted Input");
+            perf(INTROSELECT, ASCENDING);
+            perf(STD_BASELINES, ASCENDING);
+            p.createGroup("Introselect vs Partial Sort Times - Sorted Input", "introselect-time", "partial-sort-top-k-time");
+            p.createGroup("Introselect vs Standard Library Times - Sorted Input", "introselect-time", "partial-sort-top-k-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+
+            p.reset("Introselect - Descending Input");
+            perf(INTROSELECT, DESCENDING);
+            perf(STD_BASELINES, DESCENDING);
+            p.createGroup("Introselect vs Standard Library Times - Descending Input", "introselect-time", "partial-sort-top-k-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+
+            p.reset("Introselect vs Hybrid Quicksort - Large Arrays");
+            perfLarge(INTROSELECT);
+            perfLarge(HYBRID_QUICKSORT);
+            perfLarge(STD_BASELINES);
+
+            p.createGroup("Partial Sort Top-K Large Times", "introselect-large-time", "partial-sort-top-k-large-time",
+                "partial-sort-top-k-ascending-large-time", "hybrid-quicksort-large-time");
+            p.createGroup("Introselect vs Hybrid Quicksort Large Times", "introselect-large-time", "hybrid-quicksort-large-time",
+                STD_SORT_SERIES("large-time"), STD_STABLE_SORT_SERIES("large-time"), STD_HEAP_SORT_SERIES("large-time"), STD_PAR_SORT_SERIES("large-time"));
+            break;
+        }
+        case HEAP_LAYOUT_ANALYSIS: {
+            p.reset("Binary vs D-ary Heapsort - Average Case");
+            perf(HEAPSORT, UNSORTED);
+            perf(FLOYD_HEAPSORT, UNSORTED);
+            perf(DARY_HEAPSORT, UNSORTED);
+
+            p.createGroup("Binary vs D-ary Heapsort", "heapsort-total", "floyd-heapsort-total", "dary-heapsort-total");
+
+            p.reset("Binary vs D-ary Heapsort - Large Arrays");
+            perfLarge(HEAPSORT);
+            perfLarge(FLOYD_HEAPSORT);
+            perfLarge(DARY_HEAPSORT);
+            perfLarge(HYBRID_QUICKSORT);
+            perfLarge(STD_BASELINES);
+
+            p.createGroup("Binary vs D-ary Heapsort Large Times", "heapsort-large-time", "floyd-heapsort-large-time", "dary-heapsort-4-large-time",
+                "dary-heapsort-8-large-time", "hybrid-quicksort-large-time",
+                STD_SORT_SERIES("large-time"), STD_STABLE_SORT_SERIES("large-time"), STD_HEAP_SORT_SERIES("large-time"), STD_PAR_SORT_SERIES("large-time"));
+            break;
+        }
+        case SIMD_SORT_ANALYSIS: {
+            p.reset("SIMD Sort vs Hybrid Quicksort - Average Case");
+            perf(SIMD_SORT, UNSORTED);
+            perf(HYBRID_QUICKSORT, UNSORTED);
+            perf(GENERIC_HYBRID_SORT, UNSORTED);
+            perf(STD_BASELINES, UNSORTED);
+
+            p.createGroup("SIMD Sort vs Hybrid Quicksort", "simd-sort-total", "hybrid-quicksort-total");
+            p.createGroup("SIMD Sort vs Hybrid Quicksort Times", "simd-sort-time", "hybrid-quicksort-time", "generic-sort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+
+            p.reset("SIMD Sort vs Hybrid Quicksort - Large Arrays");
+            perfLarge(SIMD_SORT);
+            perfLarge(HYBRID_QUICKSORT);
+            perfLarge(GENERIC_HYBRID_SORT);
+            perfLarge(STD_BASELINES);
+
+            p.createGroup("SIMD Sort vs Hybrid Quicksort Large Times", "simd-sort-large-time", "hybrid-quicksort-large-time", "generic-sort-large-time",
+                STD_SORT_SERIES("large-time"), STD_STABLE_SORT_SERIES("large-time"), STD_HEAP_SORT_SERIES("large-time"), STD_PAR_SORT_SERIES("large-time"));
+            break;
+        }
+        case MSD_RADIX_ANALYSIS: {
+            p.reset("MSD Radix Sort vs LSD Radix Sort - Average Case");
+            perf(MSD_RADIX_SORT, UNSORTED);
+            perf(HYBRID_QUICKSORT, UNSORTED);
+            perf(STD_BASELINES, UNSORTED);
+
+            p.createGroup("MSD Radix Sort vs Hybrid Quicksort", "msd-radix-sort-total", "hybrid-quicksort-total");
+            p.createGroup("MSD Radix Sort vs Hybrid Quicksort Times", "msd-radix-sort-time", "hybrid-quicksort-time",
+                STD_SORT_SERIES("time"), STD_STABLE_SORT_SERIES("time"), STD_HEAP_SORT_SERIES("time"), STD_PAR_SORT_SERIES("time"));
+
+            p.reset("MSD Radix Sort vs LSD Radix Sort - Large Arrays");
+            perfLarge(MSD_RADIX_SORT);
+            perfLarge(RADIX_SORT);
+            perfLarge(PARALLEL_MERGESORT);
+            perfLarge(HYBRID_QUICKSORT);
+            perfLarge(STD_BASELINES);
+
+            p.createGroup("In-Place MSD vs LSD Radix Sort Large Times", "msd-radix-sort-large-time", "radixsort-large-time",
+                "parallel-merge-sort-large-time", "hybrid-quicksort-large-time",
+                STD_SORT_SERIES("large-time"), STD_STABLE_SORT_SERIES("large-time"), STD_HEAP_SORT_SERIES("large-time"), STD_PAR_SORT_SERIES("large-time"));
+            break;
+        }
+        case EXTERNAL_SORT_ANALYSIS: {
+            p.reset("External Merge Sort vs In-Memory Parallel Merge Sort - Large Arrays");
+            perfLarge(EXTERNAL_SORT);
+            perfLarge(PARALLEL_MERGESORT);
+            perfLarge(STD_BASELINES);
+
+            p.createGroup("External vs In-Memory Merge Sort Times", "external-sort-large-time", "parallel-merge-sort-large-time",
+                STD_SORT_SERIES("large-time"), STD_STABLE_SORT_SERIES("large-time"), STD_HEAP_SORT_SERIES("large-time"), STD_PAR_SORT_SERIES("large-time"));
             break;
         }
         default:
@@ -461,10 +3563,34 @@ void perf_all() {
     perfAnalysis(HYBRID_THRESHOLD_ANALYSIS);
 
     perfAnalysis(QUICKSORT_VS_HYBRID_QUICKSORT);
+
+    perfAnalysis(RADIX_VS_HYBRID_QUICKSORT);
+
+    perfAnalysis(ADAPTIVE_SORT_ANALYSIS);
+
+    perfAnalysis(MERGESORT_ANALYSIS);
+
+    perfAnalysis(PARALLEL_MERGESORT_ANALYSIS);
+
+    perfAnalysis(BASE_CASE_ANALYSIS);
+
+    perfAnalysis(GENERIC_SORT_ANALYSIS);
+
+    perfAnalysis(SELECTION_ANALYSIS);
+
+    perfAnalysis(EXTERNAL_SORT_ANALYSIS);
+
+    perfAnalysis(HEAP_LAYOUT_ANALYSIS);
+
+    perfAnalysis(SIMD_SORT_ANALYSIS);
+
+    perfAnalysis(MSD_RADIX_ANALYSIS);
     p.showReport();
 }
 
 int main() {
+    loadHybridTuning();
+    // calibrateHybrid();
     // printf("Hello World!\n");
     // demo(HEAPSORT);
     // demo(QUICKSORT);
@@ -474,6 +3600,17 @@ int main() {
     // demo(HYBRID_QUICKSORT);
     // perfAnalysis(HYBRID_THRESHOLD_ANALYSIS);
     // perfAnalysis(QUICKSORT_VS_HYBRID_QUICKSORT);
+    // perfAnalysis(RADIX_VS_HYBRID_QUICKSORT);
+    // perfAnalysis(ADAPTIVE_SORT_ANALYSIS);
+    // perfAnalysis(MERGESORT_ANALYSIS);
+    // perfAnalysis(PARALLEL_MERGESORT_ANALYSIS);
+    // perfAnalysis(BASE_CASE_ANALYSIS);
+    // perfAnalysis(GENERIC_SORT_ANALYSIS);
+    // perfAnalysis(SELECTION_ANALYSIS);
+    // perfAnalysis(EXTERNAL_SORT_ANALYSIS);
+    // perfAnalysis(HEAP_LAYOUT_ANALYSIS);
+    // perfAnalysis(SIMD_SORT_ANALYSIS);
+    // perfAnalysis(MSD_RADIX_ANALYSIS);
     demo_all();
     // perf_all();
     return 0;
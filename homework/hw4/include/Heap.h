@@ -0,0 +1,238 @@
+#ifndef HEAP_H
+#define HEAP_H
+
+/*
+    Heap d-ar (header-only), folosit de HeapSort (temele 2 si 3) si de heap-ul pentru interclasarea listelor (tema 4).
+
+    Un nod i are copiii D * i + 1 .. D * i + D, asezati consecutiv in memorie, iar parintele (i - 1) / D. Fata de heap-ul binar
+    (left(i) = 2i + 1), inaltimea scade de la log2 n la logD n, deci se ating de D / 2 ori mai putine niveluri (si linii de cache) pe
+    o cernere, in schimbul a D - 1 comparatii pe nivel pentru alegerea copilului. Pentru D = 4 / 8 si int, un grup de copii are 16 / 32 de
+    octeti; in DaryHeap memoria este alocata astfel incat `data + 1` sa fie aliniat la HEAP_CACHE_LINE, deci fiecare grup de copii este
+    intr-o singura linie de cache cand D * sizeof(T) divide HEAP_CACHE_LINE. Pentru heapSort in loc, gruparea depinde de adresa vectorului.
+
+    `before(x, y)` spune ca x trebuie sa fie mai aproape de radacina decat y: HeapGreater da un max-heap (pentru sortare crescatoare),
+    HeapLess un min-heap. Cernerile folosesc o "gaura" (o atribuire pe nivel in loc de o interschimbare de 3). Pentru daryHeapSort pe int
+    cu D = 4 / 8, pe x86 cu GCC/Clang, exista o varianta compilata cu __attribute__((target("sse4.1"))) in care maximul unui grup complet
+    de copii se calculeaza vectorial (max + cmpeq + movemask); ea este aleasa la rulare daca procesorul are SSE4.1
+    (__builtin_cpu_supports), altfel se foloseste varianta scalara. Rezultatul si numarul de operatii sunt identice (primul maxim).
+    Contoarele compare/assign sunt optionale (NULL = nu se numara), ca in Sort.h.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HEAP_SIMD_AVAILABLE
+#define HEAP_SIMD_TARGET __attribute__((target("sse4.1")))
+#endif
+#include "Profiler.h"
+
+#define HEAP_CACHE_LINE 64
+
+inline void heapCount(Operation* op, int increment = 1) {
+    if (op) op->count(increment);
+}
+
+struct HeapGreater {
+    template <typename T>
+    bool operator()(const T& x, const T& y) const {
+        return y < x;
+    }
+};
+
+struct HeapLess {
+    template <typename T>
+    bool operator()(const T& x, const T& y) const {
+        return x < y;
+    }
+};
+
+template <typename T, typename Before>
+int daryScanBestChild(const T a[], int first, int count, Before before, Operation* compare) {
+    heapCount(compare, count - 1);
+    int best = first;
+    for (int c = first + 1; c < first + count; c++) {
+        best = before(a[c], a[best]) ? c : best;
+    }
+    return best;
+}
+
+template <int D, typename T, typename Before>
+void darySiftDown(T a[], int n, int hole, T x, Before before, Operation* compare, Operation* assign) {
+    while (D * hole + 1 < n) {
+        int first = D * hole + 1;
+        int count = n - first < D ? n - first : D;
+        int child = daryScanBestChild(a, first, count, before, compare);
+        heapCount(compare);
+        if (!before(a[child], x)) {
+            break;
+        }
+        heapCount(assign);
+        a[hole] = a[child];
+        hole = child;
+    }
+    heapCount(assign);
+    a[hole] = x;
+}
+
+template <int D, typename T, typename Before>
+void darySiftUp(T a[], int hole, T x, Before before, Operation* compare, Operation* assign) {
+    while (hole > 0) {
+        int parent = (hole - 1) / D;
+        heapCount(compare);
+        if (!before(x, a[parent])) {
+            break;
+        }
+        heapCount(assign);
+        a[hole] = a[parent];
+        hole = parent;
+    }
+    heapCount(assign);
+    a[hole] = x;
+}
+
+template <int D, typename T, typename Before>
+void buildDaryHeap(T a[], int n, Before before, Operation* compare = NULL, Operation* assign = NULL) {
+    for (int i = (n - 2) / D; i >= 0 && n > 1; i--) {
+        heapCount(assign);
+        darySiftDown<D>(a, n, i, a[i], before, compare, assign);
+    }
+}
+
+#ifdef HEAP_SIMD_AVAILABLE
+inline bool heapSimdSupported() {
+    static const bool supported = __builtin_cpu_supports("sse4.1");
+    return supported;
+}
+
+template <int D>
+HEAP_SIMD_TARGET inline int daryVectorBestChild(const int a[], int first, Operation* compare) {
+    heapCount(compare, D - 1);
+    __m128i low = _mm_loadu_si128((const __m128i*)(a + first));
+    __m128i high = D == 8 ? _mm_loadu_si128((const __m128i*)(a + first + 4)) : low;
+    __m128i best = _mm_max_epi32(low, high);
+    best = _mm_max_epi32(best, _mm_shuffle_epi32(best, 0x4E));
+    best = _mm_max_epi32(best, _mm_shuffle_epi32(best, 0xB1));
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(low, best)));
+    if (D == 8) {
+        mask |= _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(high, best))) << 4;
+    }
+    return first + __builtin_ctz(mask);
+}
+
+template <int D>
+HEAP_SIMD_TARGET void darySiftDownVector(int a[], int n, int hole, int x, Operation* compare, Operation* assign) {
+    while (D * hole + 1 < n) {
+        int first = D * hole + 1;
+        int count = n - first < D ? n - first : D;
+        int child = count == D ? daryVectorBestChild<D>(a, first, compare) : daryScanBestChild(a, first, count, HeapGreater(), compare);
+        heapCount(compare);
+        if (a[child] <= x) {
+            break;
+        }
+        heapCount(assign);
+        a[hole] = a[child];
+        hole = child;
+    }
+    heapCount(assign);
+    a[hole] = x;
+}
+
+template <int D>
+HEAP_SIMD_TARGET void daryHeapSortVector(int a[], int n, Operation* compare, Operation* assign) {
+    for (int i = (n - 2) / D; i >= 0 && n > 1; i--) {
+        heapCount(assign);
+        darySiftDownVector<D>(a, n, i, a[i], compare, assign);
+    }
+    for (int i = n - 1; i > 0; i--) {
+        heapCount(assign, 2);
+        int x = a[i];
+        a[i] = a[0];
+        darySiftDownVector<D>(a, i, 0, x, compare, assign);
+    }
+}
+#endif
+
+template <int D, typename T>
+struct DaryVectorHeapSort {
+    static bool run(T[], int, Operation*, Operation*) {
+        return false;
+    }
+};
+
+#ifdef HEAP_SIMD_AVAILABLE
+template <int D>
+struct DaryVectorHeapSort<D, int> {
+    static bool run(int a[], int n, Operation* compare, Operation* assign) {
+        if ((D != 4 && D != 8) || !heapSimdSupported()) {
+            return false;
+        }
+        daryHeapSortVector<D>(a, n, compare, assign);
+        return true;
+    }
+};
+#endif
+
+template <int D, typename T>
+void daryHeapSort(T a[], int n, Operation* compare = NULL, Operation* assign = NULL) {
+    if (DaryVectorHeapSort<D, T>::run(a, n, compare, assign)) {
+        return;
+    }
+    buildDaryHeap<D>(a, n, HeapGreater(), compare, assign);
+    for (int i = n - 1; i > 0; i--) {
+        heapCount(assign, 2);
+        T x = a[i];
+        a[i] = a[0];
+        darySiftDown<D>(a, i, 0, x, HeapGreater(), compare, assign);
+    }
+}
+
+template <int D, typename T>
+struct DaryHeap {
+    static_assert(std::is_trivially_copyable<T>::value, "DaryHeap stores trivially copyable elements");
+    T* data;
+    char* storage;
+    int size;
+    int capacity;
+};
+
+template <int D, typename T>
+void daryHeapInit(DaryHeap<D, T>* h, int capacity) {
+    h->storage = new char[(capacity + 1) * sizeof(T) + HEAP_CACHE_LINE];
+    uintptr_t firstChild = ((uintptr_t)(h->storage + sizeof(T)) + HEAP_CACHE_LINE - 1) & ~(uintptr_t)(HEAP_CACHE_LINE - 1);
+    h->data = (T*)(firstChild - sizeof(T));
+    h->size = 0;
+    h->capacity = capacity;
+}
+
+template <int D, typename T>
+void daryHeapFree(DaryHeap<D, T>* h) {
+    delete[] h->storage;
+    h->storage = NULL;
+    h->data = NULL;
+    h->size = 0;
+    h->capacity = 0;
+}
+
+template <int D, typename T, typename Before>
+bool daryHeapPush(DaryHeap<D, T>* h, T x, Before before, Operation* compare = NULL, Operation* assign = NULL) {
+    if (h->size >= h->capacity) {
+        return false;
+    }
+    darySiftUp<D>(h->data, h->size++, x, before, compare, assign);
+    return true;
+}
+
+template <int D, typename T, typename Before>
+T daryHeapPop(DaryHeap<D, T>* h, Before before, Operation* compare = NULL, Operation* assign = NULL) {
+    heapCount(assign);
+    T top = h->data[0];
+    h->size--;
+    if (h->size > 0) {
+        darySiftDown<D>(h->data, h->size, 0, h->data[h->size], before, compare, assign);
+    }
+    return top;
+}
+
+#endif
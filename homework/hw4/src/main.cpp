@@ -12,6 +12,59 @@
         Timp: O(n log k)
         Spatiu: O(k) pentru heap, plus O(n) pentru lista rezultata si listele de input.
 
+    MinHeap retine perechi (cheie, nod) in vector (HeapEntry), deci comparatiile din cerneri citesc doar vectorul heap-ului, fara sa
+    urmeze pointerii spre noduri. Dupa ce minimul este legat in rezultat, daca lista lui mai are un nod, acesta ii ia locul in radacina
+    (replaceTop) si se face o singura cernere in jos, in loc de extractMin (mutarea ultimului element + cernere) urmat de insertMinHeap
+    (cernere in sus); extractMin ramane doar pentru listele epuizate.
+
+    Heap 4-ar (Heap.h): mergeKListsDary face aceeasi interclasare cu un DaryHeap<MERGE_HEAP_ARITY, Node*>, in care copiii unui nod sunt
+    consecutivi si grupul lor (4 pointeri = 32 de octeti) este intr-o singura linie de cache. Inaltimea heap-ului scade la log4 k, dar
+    alegerea copilului costa 3 comparatii pe nivel; seria merge-k-dary-variable este comparata cu merge-k-variable.
+
+    Arbore de perdanti (loser tree): mergeKListsLoserTree pastreaza capetele celor k liste ca frunze ale unui arbore binar complet
+    (frunza i pe pozitia k + i, parintele pos / 2), iar fiecare nod intern tree[1..k-1] retine indicele listei care a pierdut meciul
+    din acel nod; tree[0] este castigatorul. Dupa ce nodul castigator este legat in rezultat, doar lista lui isi schimba capul, deci se
+    rejoaca o singura data drumul frunza -> radacina: la fiecare nivel noul candidat este comparat cu perdantul memorat si castigatorul
+    urca. Sunt cel mult ceil(log2 k) comparatii pe element (fata de pana la 2 log2 k la cernerea din MinHeap) si nicio
+    interschimbare, doar scrierea perdantului. O lista epuizata (nullptr) pierde orice meci, iar la egalitate castiga indicele mai mic,
+    deci interclasarea este stabila. Operatiile (comparatii + scrieri in arbore) sunt numarate in acelasi Operation, in seriile
+    merge-k-loser-* comparate cu merge-k-*.
+
+    Sortarea unei liste nesortate: listMergeSort este un merge sort bottom-up iterativ direct pe lista (fara recursivitate, doar relegarea
+    pointerilor `next`). Lista este parcursa o singura data si taiata in secvente naturale (cutRun: o secventa crescatoare, sau una strict
+    descrescatoare care este inversata pe loc, deci sortarea ramane stabila). Secventele deja interclasate asteapta intr-un vector fix de
+    LIST_SORT_LEVELS liste, cel mult una pe nivel (nivel = log2 din lungime), ca intr-un contor binar: o secventa noua este interclasata cu
+    cele in asteptare de nivel cel mult egal cu al ei, deci interclasarile sunt echilibrate, memoria suplimentara este O(1) si nodurile sunt
+    interclasate cat timp sunt inca in cache, nu in treceri complete peste toata lista. Timp O(n log r) pentru r secvente initiale, deci
+    O(n) pentru o lista deja sortata sau inversata. listArraySort este varianta de referinta: copiaza pointerii nodurilor intr-un vector,
+    il sorteaza cu hybridSort dupa valoare (Sort.h, comun cu temele 3, 5 si 8) si reface legaturile. perfListSort compara numarul de
+    operatii (comparatii + legaturi / atribuiri) si timpii pe liste de 100000 - 1000000 de noduri.
+
+    Alocarea nodurilor: createNode foloseste `new Node()` pentru fiecare element, iar freeList sterge nodurile unul cate unul. Daca firul
+    curent are o arena activa (pointerul thread_local nodeArena, deci fiecare fir poate avea arena lui, fara sincronizare), nodurile sunt
+    luate prin incrementarea unui index dintr-un bloc de NODE_ARENA_BLOCK noduri (NodeBlock), blocurile noi fiind alocate doar cand cel
+    curent se umple. Fiecare nod retine daca provine din arena (inArena, in spatiul de aliniere dintre value si next, deci nodul ramane de
+    16 octeti), iar freeList sterge doar nodurile alocate cu new; nodurile din arena sunt eliberate toate odata, cu nodeArenaReset (blocurile
+    raman alocate si sunt refolosite) sau nodeArenaFree (blocurile sunt sterse). Nodurile unei liste construite in arena sunt si consecutive
+    in memorie. perf si perfListSort construiesc listele intr-o arena si o golesc cu nodeArenaReset dupa fiecare masuratoare.
+    perfListAllocation compara timpii de creare si eliberare a listelor de 100000 - 1000000 de noduri cu new / delete si cu arena (blocuri
+    noi sau refolosite); perf_all ruleaza toate masuratorile temei, inclusiv pe aceasta, intr-un singur raport.
+
+    Interclasarea unor secvente din vectori: mergeKRuns(runs, lengths, k, out) primeste k secvente sortate contigue (de exemplu bucati
+    sortate separat ale unui vector) si scrie rezultatul intr-un singur vector. Foloseste acelasi arbore de perdanti ca
+    mergeKListsLoserTree, dar fiecare nod retine direct cheia pe 64 de biti (valoarea cu bitul de semn inversat in partea superioara,
+    indicele secventei in cea inferioara), deci o singura comparatie fara semn da si ordinea, si departajarea stabila dupa indice, fara
+    citiri din secvente. La rejucarea drumului, perdantul si castigatorul sunt schimbati printr-o masca (fara salturi dependente de date),
+    castigatorul ramane intr-un registru intre iteratii, iar cheia urmatorului element din fiecare secventa este pregatita dinainte
+    (lookahead), deci pe lantul de dependente dintre doua elemente scrise este o singura citire. Valoarea scrisa in `out` vine din cheie.
+    O secventa epuizata primeste cheia santinela (0xFFFFFFFF, indice), cel putin egala cu orice cheie reala, iar bucla se opreste dupa
+    exact suma lungimilor. La fiecare avans se cere (_mm_prefetch) linia aflata la RUN_MERGE_PREFETCH_INTS elemente in fata in secventa
+    respectiva, deci citirile din cele k secvente nu asteapta dupa memorie. Timpul este dat de lantul de ceil(log2 k) comparatii pe
+    element, nu de latimea de banda: perfRunMerge il compara cu memcpy pe aceeasi dimensiune (limita de latime de banda) si cu
+    interclasarea acelorasi date ca liste (MinHeap si arbore de perdanti). merge-k-runs-* numara, ca replayLoserTree, o comparatie pe
+    fiecare nivel rejucat, o scriere in arbore pentru fiecare schimb efectiv si scrierea in `out`; contorul este acumulat local si
+    adaugat o singura data, ca bucla sa nu contina apeluri.
+
     Observatii:
         Atat pentru k fix (5, 10, 100) si n variabil (100 la 10000, pas 100), cat si pentru n fix (10000) si k variabil (10 la 500, pas 10),
         numarul de operatii creste liniar cu n si logaritmic cu k.
@@ -19,34 +72,119 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include "Profiler.h"
+#include "Heap.h"
+#include "Sort.h"
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define RUN_MERGE_PREFETCH
+#endif
 
 #define MAX_K 500
 #define MAX_N 10000
+#define MERGE_HEAP_ARITY 4
+#define MIN_LIST_SORT_N 100000
+#define MAX_LIST_SORT_N 1000000
+#define LIST_SORT_STEP 100000
+#define NR_LIST_SORT_TESTS 5
+#define LIST_SORT_LEVELS 32
+#define NODE_ARENA_BLOCK 4096
+#define RUN_MERGE_K 100
+#define RUN_MERGE_PREFETCH_INTS 32
 
 Profiler p;
 
 enum testMode {
     GENERATE = 0,
     MERGE_K_2 = 1,
-    MERGE = 2
+    MERGE = 2,
+    MERGE_DARY = 3,
+    LIST_SORT = 4,
+    MERGE_LOSER_TREE = 5,
+    MERGE_RUNS = 6
 };
 
 struct Node {
     int value;
+    bool inArena;
     Node* next;
 };
 
+struct NodeBlock {
+    Node nodes[NODE_ARENA_BLOCK];
+    NodeBlock* next;
+};
+
+struct NodeArena {
+    NodeBlock* first;
+    NodeBlock* current;
+    int used;
+};
+
+thread_local NodeArena* nodeArena = nullptr;
+
+struct LoserTree {
+    Node* heads[MAX_K];
+    int tree[MAX_K];
+    int k;
+};
+
+struct HeapEntry {
+    int key;
+    Node* node;
+};
+
 struct MinHeap {
-    Node* arr[MAX_K];
+    HeapEntry arr[MAX_K];
     int size; 
     int capacity;             
 };
 
+void nodeArenaInit(NodeArena* arena) {
+    arena->first = nullptr;
+    arena->current = nullptr;
+    arena->used = NODE_ARENA_BLOCK;
+}
+
+Node* nodeArenaAllocate(NodeArena* arena) {
+    if (arena->used == NODE_ARENA_BLOCK) {
+        NodeBlock* next = arena->current != nullptr ? arena->current->next : arena->first;
+        if (next == nullptr) {
+            next = new NodeBlock;
+            next->next = nullptr;
+            if (arena->current != nullptr) {
+                arena->current->next = next;
+            } else {
+                arena->first = next;
+            }
+        }
+        arena->current = next;
+        arena->used = 0;
+    }
+    return &arena->current->nodes[arena->used++];
+}
+
+void nodeArenaReset(NodeArena* arena) {
+    arena->current = nullptr;
+    arena->used = NODE_ARENA_BLOCK;
+}
+
+void nodeArenaFree(NodeArena* arena) {
+    NodeBlock* block = arena->first;
+    while (block != nullptr) {
+        NodeBlock* next = block->next;
+        delete block;
+        block = next;
+    }
+    nodeArenaInit(arena);
+}
+
 Node* createNode(int val) {
-    Node* newNode = new Node();
+    Node* newNode = nodeArena != nullptr ? nodeArenaAllocate(nodeArena) : new Node();
     newNode->value = val;
+    newNode->inArena = nodeArena != nullptr;
     newNode->next = nullptr;
     return newNode;
 }
@@ -79,7 +217,9 @@ void freeList(Node* head) {
     Node* nextNode;
     while (current != nullptr) {
         nextNode = current->next;
-        delete current;
+        if (!current->inArena) {
+            delete current;
+        }
         current = nextNode;
     }
 }
@@ -113,6 +253,35 @@ void generateLists(Node* lists[], int k, int n) {
     delete[] sizes;
 }
 
+void generateRuns(int a[], const int* runs[], int lengths[], int k, int n) {
+    if (k <= 0 || n < k) {
+        return;
+    }
+    for (int i = 0; i < k; i++) {
+        lengths[i] = 1;
+    }
+    for (int i = 0; i < n - k; i++) {
+        lengths[rand() % k]++;
+    }
+
+    int offset = 0;
+    for (int i = 0; i < k; i++) {
+        FillRandomArray(a + offset, lengths[i], 10, 50000, false, ASCENDING);
+        runs[i] = a + offset;
+        offset += lengths[i];
+    }
+}
+
+void printRuns(const int* runs[], const int lengths[], int k) {
+    for (int i = 0; i < k; i++) {
+        printf("Run %d: ", i);
+        for (int j = 0; j < lengths[i]; j++) {
+            printf("%d ", runs[i][j]);
+        }
+        printf("\n");
+    }
+}
+
 void printLists(Node* lists[], int k) {
     for (int i = 0; i < k; i++) {
         printf("List %d: ", i);
@@ -127,8 +296,8 @@ MinHeap* createMinHeap(int capacity) {
     return minHeap;
 }
 
-void swapNodes(Node **a, Node **b) {
-    Node* temp = *a;
+void swapEntries(HeapEntry* a, HeapEntry* b) {
+    HeapEntry temp = *a;
     *a = *b;
     *b = temp;
 }
@@ -140,21 +309,21 @@ void minHeapify(MinHeap* h, int i, Operation operationCounter) {
 
     if (left < h->size) {
         operationCounter.count();
-        if (h->arr[left]->value < h->arr[smallest]->value) {
+        if (h->arr[left].key < h->arr[smallest].key) {
             smallest = left;
         }
     }
 
     if (right < h->size) {
         operationCounter.count();
-        if (h->arr[right]->value < h->arr[smallest]->value) {
+        if (h->arr[right].key < h->arr[smallest].key) {
             smallest = right;
         }
     }
 
     if (smallest != i) {
         operationCounter.count(3);
-        swapNodes(&h->arr[smallest], &h->arr[i]);
+        swapEntries(&h->arr[smallest], &h->arr[i]);
         minHeapify(h, smallest, operationCounter);
     }
 }
@@ -165,7 +334,8 @@ void insertMinHeap(MinHeap* h, Node* node, Operation operationCounter) {
     }
 
     operationCounter.count();
-    h->arr[h->size] = node;
+    h->arr[h->size].key = node->value;
+    h->arr[h->size].node = node;
 
     h->size++;
 
@@ -173,9 +343,9 @@ void insertMinHeap(MinHeap* h, Node* node, Operation operationCounter) {
 
     while (i > 0) {
         operationCounter.count();
-        if (h->arr[i]->value < h->arr[(i - 1) / 2]->value) {
+        if (h->arr[i].key < h->arr[(i - 1) / 2].key) {
             operationCounter.count(3);
-            swapNodes(&h->arr[i], &h->arr[(i - 1) / 2]);
+            swapEntries(&h->arr[i], &h->arr[(i - 1) / 2]);
             i = (i - 1) / 2;
         } else {
             break;
@@ -190,7 +360,7 @@ Node* extractMin(MinHeap* h, Operation operationCounter) {
     }
 
     operationCounter.count();
-    Node* root = h->arr[0];
+    Node* root = h->arr[0].node;
 
     if (h->size > 1) {
         operationCounter.count();
@@ -204,6 +374,13 @@ Node* extractMin(MinHeap* h, Operation operationCounter) {
     return root;
 }
 
+void replaceTop(MinHeap* h, Node* node, Operation operationCounter) {
+    operationCounter.count();
+    h->arr[0].key = node->value;
+    h->arr[0].node = node;
+    minHeapify(h, 0, operationCounter);
+}
+
 Node* mergeKLists(Node* lists[], int k, Operation operationCounter) {
     MinHeap* h = createMinHeap(k); 
 
@@ -213,27 +390,369 @@ Node* mergeKLists(Node* lists[], int k, Operation operationCounter) {
         }
     }
 
-    Node* dummyHead = createNode(-1); 
-    Node* currentTail = dummyHead;
+    Node dummyHead = {-1, false, nullptr};
+    Node* currentTail = &dummyHead;
 
     while (h->size > 0) {
-        Node* minNode = extractMin(h, operationCounter);
+        operationCounter.count();
+        Node* minNode = h->arr[0].node;
 
         currentTail->next = minNode;
         currentTail = minNode; 
 
         if (minNode->next != nullptr) {
-            insertMinHeap(h, minNode->next, operationCounter);
+            replaceTop(h, minNode->next, operationCounter);
+        } else {
+            extractMin(h, operationCounter);
         }
     }
 
-    Node* mergedHead = dummyHead->next;
-    delete dummyHead;
+    Node* mergedHead = dummyHead.next;
     delete h;
 
     return mergedHead;
 }
 
+struct NodeLess {
+    bool operator()(const Node* x, const Node* y) const {
+        return x->value < y->value;
+    }
+};
+
+Node* mergeKListsDary(Node* lists[], int k, Operation operationCounter) {
+    DaryHeap<MERGE_HEAP_ARITY, Node*> h;
+    daryHeapInit(&h, k);
+
+    for (int i = 0; i < k; i++) {
+        if (lists[i] != nullptr) {
+            daryHeapPush(&h, lists[i], NodeLess(), &operationCounter, &operationCounter);
+        }
+    }
+
+    Node dummyHead = {-1, false, nullptr};
+    Node* currentTail = &dummyHead;
+
+    while (h.size > 0) {
+        Node* minNode = daryHeapPop(&h, NodeLess(), &operationCounter, &operationCounter);
+
+        currentTail->next = minNode;
+        currentTail = minNode;
+
+        if (minNode->next != nullptr) {
+            daryHeapPush(&h, minNode->next, NodeLess(), &operationCounter, &operationCounter);
+        }
+    }
+
+    Node* mergedHead = dummyHead.next;
+    daryHeapFree(&h);
+
+    return mergedHead;
+}
+
+bool loserTreeBefore(const LoserTree* t, int x, int y, Operation operationCounter) {
+    operationCounter.count();
+    if (t->heads[y] == nullptr) {
+        return t->heads[x] != nullptr || x < y;
+    }
+    if (t->heads[x] == nullptr) {
+        return false;
+    }
+    return t->heads[x]->value < t->heads[y]->value || (t->heads[x]->value == t->heads[y]->value && x < y);
+}
+
+LoserTree* createLoserTree(Node* lists[], int k, Operation operationCounter) {
+    LoserTree* t = new LoserTree();
+    t->k = k;
+    for (int i = 0; i < k; i++) {
+        t->heads[i] = lists[i];
+    }
+
+    int winners[2 * MAX_K];
+    for (int i = 0; i < k; i++) {
+        winners[k + i] = i;
+    }
+    for (int pos = k - 1; pos >= 1; pos--) {
+        int left = winners[2 * pos];
+        int right = winners[2 * pos + 1];
+        if (loserTreeBefore(t, right, left, operationCounter)) {
+            winners[pos] = right;
+            t->tree[pos] = left;
+        } else {
+            winners[pos] = left;
+            t->tree[pos] = right;
+        }
+        operationCounter.count();
+    }
+    operationCounter.count();
+    t->tree[0] = k > 1 ? winners[1] : 0;
+
+    return t;
+}
+
+void replayLoserTree(LoserTree* t, Operation operationCounter) {
+    int winner = t->tree[0];
+    for (int pos = (winner + t->k) / 2; pos >= 1; pos /= 2) {
+        if (loserTreeBefore(t, t->tree[pos], winner, operationCounter)) {
+            operationCounter.count();
+            int loser = winner;
+            winner = t->tree[pos];
+            t->tree[pos] = loser;
+        }
+    }
+    operationCounter.count();
+    t->tree[0] = winner;
+}
+
+Node* mergeKListsLoserTree(Node* lists[], int k, Operation operationCounter) {
+    if (k <= 0) {
+        return nullptr;
+    }
+    LoserTree* t = createLoserTree(lists, k, operationCounter);
+
+    Node dummyHead = {-1, false, nullptr};
+    Node* currentTail = &dummyHead;
+
+    while (t->heads[t->tree[0]] != nullptr) {
+        int winner = t->tree[0];
+        Node* minNode = t->heads[winner];
+
+        currentTail->next = minNode;
+        currentTail = minNode;
+
+        operationCounter.count();
+        t->heads[winner] = minNode->next;
+        replayLoserTree(t, operationCounter);
+    }
+
+    delete t;
+
+    return dummyHead.next;
+}
+
+unsigned long long runKey(int value, int run) {
+    return ((unsigned long long)((unsigned int)value ^ 0x80000000u) << 32) | (unsigned int)run;
+}
+
+unsigned long long runSentinel(int run) {
+    return (0xFFFFFFFFull << 32) | (unsigned int)run;
+}
+
+int runKeyValue(unsigned long long key) {
+    return (int)((unsigned int)(key >> 32) ^ 0x80000000u);
+}
+
+void prefetchRun(const int* position) {
+#ifdef RUN_MERGE_PREFETCH
+    _mm_prefetch((const char*)(position + RUN_MERGE_PREFETCH_INTS), _MM_HINT_T0);
+#else
+    (void)position;
+#endif
+}
+
+unsigned long long runLookahead(const int* position, const int* end, int run) {
+    return position < end ? runKey(*position, run) : runSentinel(run);
+}
+
+void mergeKRuns(const int* runs[], const int lengths[], int k, int out[], Operation operationCounter) {
+    if (k <= 0) {
+        return;
+    }
+
+    const int** cursor = new const int*[k];
+    const int** end = new const int*[k];
+    unsigned long long* lookahead = new unsigned long long[k];
+    unsigned long long* tree = new unsigned long long[k];
+    unsigned long long* winners = new unsigned long long[2 * k];
+    long long total = 0;
+
+    for (int i = 0; i < k; i++) {
+        end[i] = runs[i] + lengths[i];
+        cursor[i] = lengths[i] > 0 ? runs[i] + 1 : end[i];
+        total += lengths[i];
+        prefetchRun(runs[i]);
+        winners[k + i] = runLookahead(runs[i], end[i], i);
+        lookahead[i] = runLookahead(cursor[i], end[i], i);
+    }
+    for (int pos = k - 1; pos >= 1; pos--) {
+        unsigned long long left = winners[2 * pos];
+        unsigned long long right = winners[2 * pos + 1];
+        operationCounter.count(2);
+        winners[pos] = left < right ? left : right;
+        tree[pos] = left < right ? right : left;
+    }
+    unsigned long long winner = k > 1 ? winners[1] : winners[k];
+
+    long long operations = total;
+    for (long long o = 0; o < total; o++) {
+        int run = (int)(unsigned int)winner;
+        out[o] = runKeyValue(winner);
+
+        winner = lookahead[run];
+        const int* next = cursor[run] + (cursor[run] < end[run]);
+        cursor[run] = next;
+        prefetchRun(next);
+        lookahead[run] = runLookahead(next, end[run], run);
+
+        for (int pos = (run + k) >> 1; pos >= 1; pos >>= 1) {
+            unsigned long long loser = tree[pos];
+            unsigned long long swapped = loser < winner;
+            unsigned long long exchange = (loser ^ winner) & (0 - swapped);
+            tree[pos] = loser ^ exchange;
+            winner ^= exchange;
+            operations += 1 + swapped;
+        }
+    }
+    operationCounter.count((int)operations);
+
+    delete[] cursor;
+    delete[] end;
+    delete[] lookahead;
+    delete[] tree;
+    delete[] winners;
+}
+
+int nodeValue(const Node* node) {
+    return node->value;
+}
+
+Node* cutRun(Node* head, Node** rest, int* length, Operation operationCounter) {
+    Node* last = head;
+    *length = 1;
+    if (head->next != nullptr) {
+        operationCounter.count();
+        if (head->next->value < head->value) {
+            Node* reversed = head;
+            Node* current = head->next;
+            head->next = nullptr;
+            while (true) {
+                Node* following = current->next;
+                operationCounter.count();
+                current->next = reversed;
+                reversed = current;
+                (*length)++;
+                current = following;
+                if (current == nullptr) {
+                    break;
+                }
+                operationCounter.count();
+                if (!(current->value < reversed->value)) {
+                    break;
+                }
+            }
+            *rest = current;
+            return reversed;
+        }
+        last = head->next;
+        (*length)++;
+    }
+
+    while (last->next != nullptr) {
+        operationCounter.count();
+        if (last->next->value < last->value) {
+            break;
+        }
+        last = last->next;
+        (*length)++;
+    }
+    *rest = last->next;
+    operationCounter.count();
+    last->next = nullptr;
+    return head;
+}
+
+Node* mergeRuns(Node* a, Node* b, Operation operationCounter) {
+    Node dummyHead = {-1, false, nullptr};
+    Node* currentTail = &dummyHead;
+
+    while (a != nullptr && b != nullptr) {
+        operationCounter.count();
+        if (b->value < a->value) {
+            currentTail->next = b;
+            currentTail = b;
+            b = b->next;
+        } else {
+            currentTail->next = a;
+            currentTail = a;
+            a = a->next;
+        }
+        operationCounter.count();
+    }
+
+    operationCounter.count();
+    currentTail->next = a != nullptr ? a : b;
+
+    return dummyHead.next;
+}
+
+int runLevel(int length) {
+    int level = 0;
+    while (length > 1) {
+        length >>= 1;
+        level++;
+    }
+    return level;
+}
+
+Node* listMergeSort(Node* head, Operation operationCounter) {
+    Node* pending[LIST_SORT_LEVELS] = {};
+    int pendingLength[LIST_SORT_LEVELS] = {};
+
+    Node* rest = head;
+    while (rest != nullptr) {
+        int length;
+        Node* run = cutRun(rest, &rest, &length, operationCounter);
+
+        for (int level = 0; level <= runLevel(length); level++) {
+            if (pending[level] != nullptr) {
+                run = mergeRuns(pending[level], run, operationCounter);
+                length += pendingLength[level];
+                pending[level] = nullptr;
+            }
+        }
+        pending[runLevel(length)] = run;
+        pendingLength[runLevel(length)] = length;
+    }
+
+    Node* sorted = nullptr;
+    for (int level = 0; level < LIST_SORT_LEVELS; level++) {
+        if (pending[level] != nullptr) {
+            sorted = sorted == nullptr ? pending[level] : mergeRuns(pending[level], sorted, operationCounter);
+        }
+    }
+
+    return sorted;
+}
+
+Node* listArraySort(Node* head, Operation operationCounter) {
+    int n = 0;
+    for (Node* current = head; current != nullptr; current = current->next) {
+        n++;
+    }
+    if (n < 2) {
+        return head;
+    }
+
+    Node** nodes = new Node*[n];
+    int i = 0;
+    for (Node* current = head; current != nullptr; current = current->next) {
+        operationCounter.count();
+        nodes[i++] = current;
+    }
+
+    hybridSort(nodes, nodes + n, nodeValue, KeyLess(), &operationCounter, &operationCounter);
+
+    for (i = 0; i < n - 1; i++) {
+        operationCounter.count();
+        nodes[i]->next = nodes[i + 1];
+    }
+    operationCounter.count();
+    nodes[n - 1]->next = nullptr;
+
+    head = nodes[0];
+    delete[] nodes;
+    return head;
+}
+
 void demo(int testMode) {
     switch (testMode) {
         case GENERATE: {
@@ -285,6 +804,82 @@ void demo(int testMode) {
             freeList(mergedList);
             break;
         }
+        case MERGE_DARY: {
+            int k = 5;
+            int n = 20;
+
+            Operation dummyCounter = p.createOperation("dummy-counter", n);
+
+            Node* lists[k];
+            generateLists(lists, k, n);
+            printf("Input Lists:\n");
+            printLists(lists, k);
+
+            Node* mergedList = mergeKListsDary(lists, k, dummyCounter);
+            printf("Merged List (4-ary heap):\n");
+            printList(mergedList);
+
+            freeList(mergedList);
+            break;
+        }
+        case MERGE_LOSER_TREE: {
+            int k = 5;
+            int n = 20;
+
+            Operation dummyCounter = p.createOperation("dummy-counter", n);
+
+            Node* lists[k];
+            generateLists(lists, k, n);
+            printf("Input Lists:\n");
+            printLists(lists, k);
+
+            Node* mergedList = mergeKListsLoserTree(lists, k, dummyCounter);
+            printf("Merged List (loser tree):\n");
+            printList(mergedList);
+
+            freeList(mergedList);
+            break;
+        }
+        case MERGE_RUNS: {
+            int k = 5;
+            int n = 20;
+
+            Operation dummyCounter = p.createOperation("dummy-counter", n);
+
+            int a[n];
+            int out[n];
+            const int* runs[k];
+            int lengths[k];
+            generateRuns(a, runs, lengths, k, n);
+            printf("Input Runs:\n");
+            printRuns(runs, lengths, k);
+
+            mergeKRuns(runs, lengths, k, out, dummyCounter);
+            printf("Merged Array:\n");
+            for (int i = 0; i < n; i++) {
+                printf("%d ", out[i]);
+            }
+            printf("\n");
+            break;
+        }
+        case LIST_SORT: {
+            int n = 20;
+
+            Operation dummyCounter = p.createOperation("dummy-counter", n);
+
+            int a[n];
+            FillRandomArray(a, n, 10, 50000, false, UNSORTED);
+            Node* list = createList(a, n);
+            printf("Input List:\n");
+            printList(list);
+
+            list = listMergeSort(list, dummyCounter);
+            printf("Sorted List (bottom-up merge sort):\n");
+            printList(list);
+
+            freeList(list);
+            break;
+        }
         default:
             break;
     }
@@ -294,11 +889,18 @@ void demo_all() {
     demo(GENERATE);
     demo(MERGE_K_2);
     demo(MERGE);
+    demo(MERGE_DARY);
+    demo(MERGE_LOSER_TREE);
+    demo(MERGE_RUNS);
+    demo(LIST_SORT);
 }
 
 void perf() {
     int k_values[] = {5, 10, 100};
     char* names[10] = {};
+    NodeArena arena;
+    nodeArenaInit(&arena);
+    nodeArena = &arena;
 
     for (int i = 0; i < 3; i++) {
         int k = k_values[i];
@@ -306,24 +908,204 @@ void perf() {
 
         names[i] = new char[32];
         snprintf(names[i], 32, "merge-k-%d", k);
+        names[3 + i] = new char[32];
+        snprintf(names[3 + i], 32, "merge-k-loser-%d", k);
+        names[6 + i] = new char[32];
+        snprintf(names[6 + i], 32, "merge-k-runs-%d", k);
 
         for (int n = 100; n <= MAX_N; n += 100) {
             Operation mergeOp = p.createOperation(names[i], n);
             generateLists(lists, k, n);
-            Node* mergedList = mergeKLists(lists, k, mergeOp);
-            freeList(mergedList);
+            mergeKLists(lists, k, mergeOp);
+            nodeArenaReset(&arena);
+
+            Operation loserMergeOp = p.createOperation(names[3 + i], n);
+            generateLists(lists, k, n);
+            mergeKListsLoserTree(lists, k, loserMergeOp);
+            nodeArenaReset(&arena);
+
+            int a[n];
+            int out[n];
+            const int* runs[k];
+            int lengths[k];
+            Operation runMergeOp = p.createOperation(names[6 + i], n);
+            generateRuns(a, runs, lengths, k, n);
+            mergeKRuns(runs, lengths, k, out, runMergeOp);
         }
     }
     p.createGroup("Merge K Lists Operations", names[0], names[1], names[2], names[3], names[4], names[5], names[6], names[7], names[8], names[9]);
+    for (int i = 0; i < 9; i++) {
+        delete[] names[i];
+    }
 
     for (int k = 10; k <= 500; k += 10) {
         Node* lists[k];
 
         Operation mergeOp = p.createOperation("merge-k-variable", k);
         generateLists(lists, k, MAX_N);
-        Node* mergedList = mergeKLists(lists, k, mergeOp);
-        freeList(mergedList);
+        mergeKLists(lists, k, mergeOp);
+        nodeArenaReset(&arena);
+
+        Operation daryMergeOp = p.createOperation("merge-k-dary-variable", k);
+        generateLists(lists, k, MAX_N);
+        mergeKListsDary(lists, k, daryMergeOp);
+        nodeArenaReset(&arena);
+
+        Operation loserMergeOp = p.createOperation("merge-k-loser-variable", k);
+        generateLists(lists, k, MAX_N);
+        mergeKListsLoserTree(lists, k, loserMergeOp);
+        nodeArenaReset(&arena);
     }
+    nodeArena = nullptr;
+    nodeArenaFree(&arena);
+
+    p.createGroup("Binary vs 4-ary Merge Heap", "merge-k-variable", "merge-k-dary-variable");
+    p.createGroup("Merge Heap vs Loser Tree", "merge-k-variable", "merge-k-dary-variable", "merge-k-loser-variable");
+}
+
+void perfListSort() {
+    int* a = new int[MAX_LIST_SORT_N];
+    NodeArena arena;
+    nodeArenaInit(&arena);
+    nodeArena = &arena;
+
+    for (int n = 100; n <= MAX_N; n += 100) {
+        FillRandomArray(a, n, 10, 50000, false, UNSORTED);
+
+        Operation mergeSortOp = p.createOperation("list-merge-sort", n);
+        listMergeSort(createList(a, n), mergeSortOp);
+        nodeArenaReset(&arena);
+
+        Operation arraySortOp = p.createOperation("list-array-sort", n);
+        listArraySort(createList(a, n), arraySortOp);
+        nodeArenaReset(&arena);
+    }
+    p.createGroup("List Sorting Operations", "list-merge-sort", "list-array-sort");
+
+    for (int n = MIN_LIST_SORT_N; n <= MAX_LIST_SORT_N; n += LIST_SORT_STEP) {
+        Operation dummyCounter = p.createOperation("dummy-counter", n);
+
+        for (int test = 0; test < NR_LIST_SORT_TESTS; test++) {
+            FillRandomArray(a, n, 10, 50000, false, UNSORTED);
+
+            Node* list = createList(a, n);
+            p.startTimer("list-merge-sort-time", n);
+            listMergeSort(list, dummyCounter);
+            p.stopTimer("list-merge-sort-time", n);
+            nodeArenaReset(&arena);
+
+            list = createList(a, n);
+            p.startTimer("list-array-sort-time", n);
+            listArraySort(list, dummyCounter);
+            p.stopTimer("list-array-sort-time", n);
+            nodeArenaReset(&arena);
+
+            FillRandomArray(a, n, 10, 50000, false, ASCENDING);
+            list = createList(a, n);
+            p.startTimer("list-merge-sort-sorted-time", n);
+            listMergeSort(list, dummyCounter);
+            p.stopTimer("list-merge-sort-sorted-time", n);
+            nodeArenaReset(&arena);
+        }
+    }
+    nodeArena = nullptr;
+    nodeArenaFree(&arena);
+    p.createGroup("List Sorting Times", "list-merge-sort-time", "list-array-sort-time", "list-merge-sort-sorted-time");
+
+    delete[] a;
+}
+
+void perfRunMerge() {
+    int* a = new int[MAX_LIST_SORT_N];
+    int* out = new int[MAX_LIST_SORT_N];
+    const int* runs[RUN_MERGE_K];
+    int lengths[RUN_MERGE_K];
+    Node* lists[RUN_MERGE_K];
+
+    for (int n = MIN_LIST_SORT_N; n <= MAX_LIST_SORT_N; n += LIST_SORT_STEP) {
+        Operation dummyCounter = p.createOperation("dummy-counter", n);
+
+        for (int test = 0; test < NR_LIST_SORT_TESTS; test++) {
+            generateRuns(a, runs, lengths, RUN_MERGE_K, n);
+
+            p.startTimer("merge-k-runs-time", n);
+            mergeKRuns(runs, lengths, RUN_MERGE_K, out, dummyCounter);
+            p.stopTimer("merge-k-runs-time", n);
+
+            p.startTimer("run-copy-time", n);
+            memcpy(out, a, (size_t)n * sizeof(int));
+            p.stopTimer("run-copy-time", n);
+
+            for (int i = 0; i < RUN_MERGE_K; i++) {
+                lists[i] = createList((int*)runs[i], lengths[i]);
+            }
+            p.startTimer("merge-k-lists-time", n);
+            Node* mergedList = mergeKLists(lists, RUN_MERGE_K, dummyCounter);
+            p.stopTimer("merge-k-lists-time", n);
+            freeList(mergedList);
+
+            for (int i = 0; i < RUN_MERGE_K; i++) {
+                lists[i] = createList((int*)runs[i], lengths[i]);
+            }
+            p.startTimer("merge-k-loser-lists-time", n);
+            mergedList = mergeKListsLoserTree(lists, RUN_MERGE_K, dummyCounter);
+            p.stopTimer("merge-k-loser-lists-time", n);
+            freeList(mergedList);
+        }
+    }
+    p.createGroup("Array vs List K-way Merge Times", "merge-k-runs-time", "run-copy-time", "merge-k-lists-time", "merge-k-loser-lists-time");
+
+    delete[] a;
+    delete[] out;
+}
+
+void perfListAllocation() {
+    int* a = new int[MAX_LIST_SORT_N];
+    NodeArena arena;
+    nodeArenaInit(&arena);
+
+    for (int n = MIN_LIST_SORT_N; n <= MAX_LIST_SORT_N; n += LIST_SORT_STEP) {
+        for (int test = 0; test < NR_LIST_SORT_TESTS; test++) {
+            FillRandomArray(a, n, 10, 50000, false, UNSORTED);
+
+            p.startTimer("list-new-create-time", n);
+            Node* list = createList(a, n);
+            p.stopTimer("list-new-create-time", n);
+
+            p.startTimer("list-new-free-time", n);
+            freeList(list);
+            p.stopTimer("list-new-free-time", n);
+
+            nodeArena = &arena;
+            p.startTimer("list-arena-create-time", n);
+            list = createList(a, n);
+            p.stopTimer("list-arena-create-time", n);
+
+            nodeArenaReset(&arena);
+            p.startTimer("list-arena-reuse-create-time", n);
+            list = createList(a, n);
+            p.stopTimer("list-arena-reuse-create-time", n);
+
+            nodeArena = nullptr;
+            p.startTimer("list-arena-free-time", n);
+            nodeArenaFree(&arena);
+            p.stopTimer("list-arena-free-time", n);
+        }
+    }
+    p.createGroup("List Allocation Times", "list-new-create-time", "list-new-free-time", "list-arena-create-time",
+        "list-arena-reuse-create-time", "list-arena-free-time");
+
+    delete[] a;
+}
+
+void perf_all() {
+    perf();
+    p.reset("List Sorting");
+    perfListSort();
+    p.reset("Array vs List K-way Merge");
+    perfRunMerge();
+    p.reset("List Allocation");
+    perfListAllocation();
     p.showReport();
 }
 
@@ -335,5 +1117,6 @@ int main() {
     // demo(MERGE);
     demo_all();
     // perf();
+    // perf_all();
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,705 @@
+#ifndef SORT_H
+#define SORT_H
+
+/*
+    Biblioteca generica de sortare (header-only), folosita de temele care au nevoie de Hybrid QuickSort pe alte tipuri decat int.
+
+    hybridSort(first, last, keyOf, less, compare, assign, threshold) sorteaza intervalul [first, last) al unui iterator cu acces aleator.
+    keyOf extrage cheia dintr-un element (IdentityKey implicit), iar less compara doua chei (KeyLess implicit, adica operatorul <).
+    Contoarele compare/assign sunt optionale (NULL = nu se numara), ca in tema 8.
+
+    Algoritmul este Hybrid QuickSort: pivot mediana din 3 mutat la final, partitionare Lomuto, recursivitate pe partea mai mica si iteratie
+    pe cea mai mare (stiva O(log n)), iar partitiile de cel mult `threshold` elemente sunt sortate cu un caz de baza. Partitionarea Lomuto
+    pune cheile egale cu pivotul toate in stanga, deci pe intrari cu multe duplicate (de exemplu costuri din 100 de valori) ar deveni
+    patratica. Daca partea stanga are peste 7/8 din interval (SORT_UNBALANCED_SHIFT), ea este impartita inca o data in < pivot si
+    == pivot (sortSplitEqual), iar blocul egal cu pivotul nu mai este sortat; un interval cu toate cheile egale se termina in doua treceri.
+    Mediana din 3 nu protejeaza de toate intrarile (de exemplu "organ pipe": crescator, apoi descrescator), deci sortarea are un buget de
+    adancime ca introsort: SORT_DEPTH_FACTOR * log2 n partitionari pe drum; cand bugetul se termina, intervalul ramas este sortat cu
+    heapSort (sortHeapSort, cernere cu gaura), deci cazul cel mai defavorabil este O(n log n).
+    hybridSortWithBaseCase primeste cazul de baza ca parametru (apelat cu (inceput, n)), pentru temele care il aleg la rulare (tema 3:
+    `hybridBaseCase`, retele sau insertie); binaryInsertionSortFrom(a, n, start) presupune primele `start` elemente deja sortate.
+
+    Specializare la compilare: daca cheia este de tip aritmetic, comparatorul este KeyLess si elementul este mic si trivial copiabil
+    (int, Edge etc.), se foloseste calea rapida: partitionare Lomuto fara salturi (interschimbare neconditionata, indexul avanseaza cu
+    rezultatul comparatiei) si retele de sortare cu compare-exchange fara salturi pentru n <= MAX_NETWORK_SIZE. Altfel se foloseste
+    partitionarea clasica si insertia binara (cautare fara salturi + mutare in bloc). Totul este in template-uri, deci comparatiile se
+    pot face inline.
+
+    Sortare indirecta (cheie, index) pentru inregistrari mari (Entry, Edge): sortPermutation(first, last, keyOf, perm) impacheteaza fiecare
+    element intr-un cuvant de 64 de biti (cheia intreaga pe 32 de biti in partea superioara, indexul in cea inferioara) si sorteaza cuvintele
+    cu radix sort LSD pe cheie (cifre de 8 biti, cifrele triviale sunt sarite), deci rezultatul este stabil. Permutarea rezultata poate fi
+    intoarsa direct sau aplicata o singura data cu applyPermutation (citiri indexate, scrieri secventiale intr-un buffer), iar indexSort le
+    combina. Inregistrarile sunt mutate o singura data, deci costul este aproape cel al sortarii unor int-uri.
+
+    Sortare dupa chei sir de caractere (de exemplu numele din Entry): stringSortPermutation(first, last, nameOf, width, perm) foloseste
+    multikey quicksort (Bentley-Sedgewick) pe blocuri de STRING_PREFIX_BYTES (8) octeti in loc de un singur caracter. Fiecare element este
+    reprezentat de o structura StringKeyRef (pointer la sir, index, prefixe cache-uite): cei 8 octeti de la adancimea curenta sunt impachetati
+    big-endian intr-un unsigned long long (completati cu 0 dupa NUL sau dupa `width`), deci ordinea intregilor este ordinea lexicografica
+    (ca strcmp) si partitionarea in 3 (<, =, > pivot) compara cuvinte de 64 de biti fara acces la sirurile propriu-zise. Doar pentru partea
+    egala cu pivotul se avanseaza cu 8 octeti si se reincarca prefixele; daca pivotul contine sfarsitul sirului, partea egala este deja
+    sortata. Urmatorii 8 octeti sunt cititi inca de la inceput (nextPrefix), cand sirurile sunt parcurse secvential, deci primul avans nu
+    mai face citiri aleatoare in inregistrari. Intervalele de peste STRING_RADIX_THRESHOLD elemente sunt sortate dupa prefix cu radix sort
+    LSD (cifre de 8 biti, cele comune tuturor, de exemplu "Name", sunt sarite), apoi se continua pe fiecare grup de prefixe egale; cele de
+    cel mult STRING_SORT_THRESHOLD elemente se termina cu insertie (prefix, apoi strncmp de la adancimea curenta). `width` este dimensiunea
+    campului pentru siruri de lungime fixa (sizeof(Entry::name)); atunci un bloc intreg din camp se citeste dintr-o data. Pentru siruri
+    terminate doar cu NUL se da STRING_UNBOUNDED si se citeste octet cu octet, fara a trece de NUL. Sortarea nu este stabila;
+    stringIndexSort aplica permutarea cu applyPermutation, ca indexSort.
+*/
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "Profiler.h"
+
+#define MAX_NETWORK_SIZE 16
+#define SORT_THRESHOLD 16
+#define SORT_FAST_PATH_MAX_BYTES 16
+#define SORT_UNBALANCED_SHIFT 3
+#define SORT_DEPTH_FACTOR 2
+#define KEY_INDEX_RADIX_BITS 8
+#define KEY_INDEX_RADIX_BUCKETS (1 << KEY_INDEX_RADIX_BITS)
+#define KEY_INDEX_RADIX_PASSES (32 / KEY_INDEX_RADIX_BITS)
+#define STRING_PREFIX_BYTES 8
+#define STRING_UNBOUNDED INT_MAX
+#define STRING_SORT_THRESHOLD 16
+#define STRING_RADIX_THRESHOLD 4096
+
+const unsigned char NETWORK_PAIRS[][2] = {
+    // n = 2, 1 comparator
+    {0, 1},
+    // n = 3, 3 comparators
+    {0, 2}, {0, 1}, {1, 2},
+    // n = 4, 5 comparators
+    {0, 1}, {2, 3}, {0, 2}, {1, 3}, {1, 2},
+    // n = 5, 9 comparators
+    {0, 3}, {1, 4}, {0, 2}, {1, 3}, {0, 1}, {2, 4}, {1, 2}, {3, 4}, {2, 3},
+    // n = 6, 12 comparators
+    {0, 5}, {1, 3}, {2, 4}, {1, 2}, {3, 4}, {0, 3}, {2, 5}, {0, 1}, {2, 3}, {4, 5}, {1, 2}, {3, 4},
+    // n = 7, 16 comparators
+    {0, 6}, {2, 3}, {4, 5}, {0, 2}, {1, 4}, {3, 6}, {0, 1}, {2, 5}, {3, 4}, {1, 2}, {4, 6}, {2, 3}, {4, 5}, {1, 2}, {3, 4}, {5, 6},
+    // n = 8, 19 comparators
+    {0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {2, 4}, {3, 5}, {1, 4}, {3, 6}, {1, 2},
+    {3, 4}, {5, 6},
+    // n = 9, 25 comparators
+    {0, 3}, {1, 7}, {2, 5}, {4, 8}, {0, 7}, {2, 4}, {3, 8}, {5, 6}, {0, 2}, {1, 3}, {4, 5}, {7, 8}, {1, 4}, {3, 6}, {5, 7}, {0, 1}, {2, 4},
+    {3, 5}, {6, 8}, {2, 3}, {4, 5}, {6, 7}, {1, 2}, {3, 4}, {5, 6},
+    // n = 10, 29 comparators
+    {0, 8}, {1, 9}, {2, 7}, {3, 5}, {4, 6}, {0, 2}, {1, 4}, {5, 8}, {7, 9}, {0, 3}, {2, 4}, {5, 7}, {6, 9}, {0, 1}, {3, 6}, {8, 9}, {1, 5},
+    {2, 3}, {4, 8}, {6, 7}, {1, 2}, {3, 5}, {4, 6}, {7, 8}, {2, 3}, {4, 5}, {6, 7}, {3, 4}, {5, 6},
+    // n = 11, 35 comparators
+    {0, 9}, {1, 6}, {2, 4}, {3, 7}, {5, 8}, {0, 1}, {3, 5}, {4, 10}, {6, 9}, {7, 8}, {1, 3}, {2, 5}, {4, 7}, {8, 10}, {0, 4}, {1, 2},
+    {3, 7}, {5, 9}, {6, 8}, {0, 1}, {2, 6}, {4, 5}, {7, 8}, {9, 10}, {2, 4}, {3, 6}, {5, 7}, {8, 9}, {1, 2}, {3, 4}, {5, 6}, {7, 8},
+    {2, 3}, {4, 5}, {6, 7},
+    // n = 12, 39 comparators
+    {0, 8}, {1, 7}, {2, 6}, {3, 11}, {4, 10}, {5, 9}, {0, 1}, {2, 5}, {3, 4}, {6, 9}, {7, 8}, {10, 11}, {0, 2}, {1, 6}, {5, 10}, {9, 11},
+    {0, 3}, {1, 2}, {4, 6}, {5, 7}, {8, 11}, {9, 10}, {1, 4}, {3, 5}, {6, 8}, {7, 10}, {1, 3}, {2, 5}, {6, 9}, {8, 10}, {2, 3}, {4, 5},
+    {6, 7}, {8, 9}, {4, 6}, {5, 7}, {3, 4}, {5, 6}, {7, 8},
+    // n = 13, 45 comparators
+    {0, 12}, {1, 10}, {2, 9}, {3, 7}, {5, 11}, {6, 8}, {1, 6}, {2, 3}, {4, 11}, {7, 9}, {8, 10}, {0, 4}, {1, 2}, {3, 6}, {7, 8}, {9, 10},
+    {11, 12}, {4, 6}, {5, 9}, {8, 11}, {10, 12}, {0, 5}, {3, 8}, {4, 7}, {6, 11}, {9, 10}, {0, 1}, {2, 5}, {6, 9}, {7, 8}, {10, 11},
+    {1, 3}, {2, 4}, {5, 6}, {9, 10}, {1, 2}, {3, 4}, {5, 7}, {6, 8}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {3, 4}, {5, 6},
+    // n = 14, 51 comparators
+    {0, 13}, {1, 12}, {4, 8}, {5, 6}, {7, 11}, {9, 10}, {0, 5}, {1, 7}, {2, 9}, {3, 4}, {6, 13}, {11, 12}, {0, 1}, {2, 3}, {4, 5}, {6, 8},
+    {7, 9}, {10, 11}, {12, 13}, {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9}, {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11},
+    {1, 4}, {2, 6}, {5, 8}, {7, 10}, {9, 13}, {2, 4}, {3, 6}, {9, 12}, {11, 13}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {3, 4}, {5, 6}, {7, 8},
+    {9, 10}, {11, 12}, {6, 7}, {8, 9},
+    // n = 15, 56 comparators
+    {0, 13}, {1, 12}, {3, 14}, {4, 8}, {5, 6}, {7, 11}, {9, 10}, {0, 5}, {1, 7}, {2, 9}, {3, 4}, {6, 13}, {8, 14}, {11, 12}, {0, 1},
+    {2, 3}, {4, 5}, {6, 8}, {7, 9}, {10, 11}, {12, 13}, {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9}, {12, 14}, {1, 2}, {3, 12},
+    {4, 6}, {5, 7}, {8, 10}, {9, 11}, {13, 14}, {1, 4}, {2, 6}, {5, 8}, {7, 10}, {9, 13}, {11, 14}, {2, 4}, {3, 6}, {9, 12}, {11, 13},
+    {3, 5}, {6, 8}, {7, 9}, {10, 12}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {6, 7}, {8, 9},
+    // n = 16, 60 comparators
+    {0, 13}, {1, 12}, {2, 15}, {3, 14}, {4, 8}, {5, 6}, {7, 11}, {9, 10}, {0, 5}, {1, 7}, {2, 9}, {3, 4}, {6, 13}, {8, 14}, {10, 15},
+    {11, 12}, {0, 1}, {2, 3}, {4, 5}, {6, 8}, {7, 9}, {10, 11}, {12, 13}, {14, 15}, {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9},
+    {12, 14}, {13, 15}, {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {13, 14}, {1, 4}, {2, 6}, {5, 8}, {7, 10}, {9, 13}, {11, 14},
+    {2, 4}, {3, 6}, {9, 12}, {11, 13}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {6, 7}, {8, 9}
+};
+
+const int NETWORK_OFFSET[MAX_NETWORK_SIZE + 2] = {0, 0, 0, 1, 4, 9, 18, 30, 46, 65, 90, 119, 154, 193, 238, 289, 345, 405};
+
+struct IdentityKey {
+    template <typename T>
+    const T& operator()(const T& x) const {
+        return x;
+    }
+};
+
+struct KeyLess {
+    template <typename K>
+    bool operator()(const K& x, const K& y) const {
+        return x < y;
+    }
+};
+
+template <typename RandomIt, typename KeyOf>
+struct SortKeyType {
+    typedef typename std::iterator_traits<RandomIt>::value_type value_type;
+    typedef typename std::decay<decltype(std::declval<KeyOf>()(std::declval<const value_type&>()))>::type type;
+};
+
+template <typename RandomIt, typename KeyOf, typename Less>
+struct SortFastPath : std::integral_constant<bool,
+    std::is_arithmetic<typename SortKeyType<RandomIt, KeyOf>::type>::value &&
+    std::is_same<Less, KeyLess>::value &&
+    std::is_trivially_copyable<typename std::iterator_traits<RandomIt>::value_type>::value &&
+    sizeof(typename std::iterator_traits<RandomIt>::value_type) <= SORT_FAST_PATH_MAX_BYTES> {};
+
+inline void sortCount(Operation* op, int increment = 1) {
+    if (op) op->count(increment);
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+void binaryInsertionSortFrom(RandomIt a, int n, int start, KeyOf keyOf, Less less, Operation* compare, Operation* assign) {
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    for (int i = start; i < n; i++) {
+        sortCount(compare);
+        if (!less(keyOf(a[i]), keyOf(a[i - 1]))) continue;
+
+        sortCount(assign);
+        T item = std::move(a[i]);
+        int left = 0;
+        int len = i - 1;
+        while (len > 1) {
+            int half = len / 2;
+            sortCount(compare);
+            left += !less(keyOf(item), keyOf(a[left + half])) * half;
+            len -= half;
+        }
+        if (len == 1) {
+            sortCount(compare);
+            left += !less(keyOf(item), keyOf(a[left]));
+        }
+        sortCount(assign, i - left);
+        std::move_backward(a + left, a + i, a + i + 1);
+        sortCount(assign);
+        a[left] = std::move(item);
+    }
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+void binaryInsertionSort(RandomIt a, int n, KeyOf keyOf, Less less, Operation* compare, Operation* assign) {
+    binaryInsertionSortFrom(a, n, 1, keyOf, less, compare, assign);
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+void networkSort(RandomIt a, int n, KeyOf keyOf, Less less, Operation* compare, Operation* assign) {
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    if (n > MAX_NETWORK_SIZE) {
+        binaryInsertionSort(a, n, keyOf, less, compare, assign);
+        return;
+    }
+    if (n < 2) return;
+
+    int first = NETWORK_OFFSET[n];
+    int last = NETWORK_OFFSET[n + 1];
+    sortCount(compare, last - first);
+    sortCount(assign, 2 * (last - first));
+    for (int k = first; k < last; k++) {
+        int i = NETWORK_PAIRS[k][0];
+        int j = NETWORK_PAIRS[k][1];
+        T x = a[i];
+        T y = a[j];
+        bool swapped = less(keyOf(y), keyOf(x));
+        a[i] = swapped ? y : x;
+        a[j] = swapped ? x : y;
+    }
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+void sortBaseCase(RandomIt a, int n, KeyOf keyOf, Less less, Operation* compare, Operation* assign, std::true_type) {
+    networkSort(a, n, keyOf, less, compare, assign);
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+void sortBaseCase(RandomIt a, int n, KeyOf keyOf, Less less, Operation* compare, Operation* assign, std::false_type) {
+    binaryInsertionSort(a, n, keyOf, less, compare, assign);
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+int sortPartition(RandomIt a, int left, int right, KeyOf keyOf, Less less, Operation* compare, Operation* assign, std::true_type) {
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    sortCount(assign);
+    T pivot = a[right];
+    int i = left;
+    for (int j = left; j < right; j++) {
+        T x = a[j];
+        sortCount(compare);
+        sortCount(assign, 2);
+        bool smaller = !less(keyOf(pivot), keyOf(x));
+        a[j] = a[i];
+        a[i] = x;
+        i += smaller;
+    }
+    sortCount(assign, 2);
+    a[right] = a[i];
+    a[i] = pivot;
+    return i;
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+int sortPartition(RandomIt a, int left, int right, KeyOf keyOf, Less less, Operation* compare, Operation* assign, std::false_type) {
+    int i = left;
+    for (int j = left; j < right; j++) {
+        sortCount(compare);
+        if (!less(keyOf(a[right]), keyOf(a[j]))) {
+            sortCount(assign, 3);
+            std::iter_swap(a + i, a + j);
+            i++;
+        }
+    }
+    sortCount(assign, 3);
+    std::iter_swap(a + i, a + right);
+    return i;
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+int sortSplitEqual(RandomIt a, int left, int pivotIndex, KeyOf keyOf, Less less, Operation* compare, Operation* assign, std::true_type) {
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    T pivot = a[pivotIndex];
+    int i = left;
+    for (int j = left; j < pivotIndex; j++) {
+        T x = a[j];
+        sortCount(compare);
+        sortCount(assign, 2);
+        bool smaller = less(keyOf(x), keyOf(pivot));
+        a[j] = a[i];
+        a[i] = x;
+        i += smaller;
+    }
+    return i;
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+int sortSplitEqual(RandomIt a, int left, int pivotIndex, KeyOf keyOf, Less less, Operation* compare, Operation* assign, std::false_type) {
+    int i = left;
+    for (int j = left; j < pivotIndex; j++) {
+        sortCount(compare);
+        if (less(keyOf(a[j]), keyOf(a[pivotIndex]))) {
+            sortCount(assign, 3);
+            std::iter_swap(a + i, a + j);
+            i++;
+        }
+    }
+    return i;
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+void medianOfThreeToEnd(RandomIt a, int left, int right, KeyOf keyOf, Less less, Operation* compare, Operation* assign) {
+    int mid = left + (right - left) / 2;
+    sortCount(compare);
+    if (less(keyOf(a[mid]), keyOf(a[left]))) {
+        sortCount(assign, 3);
+        std::iter_swap(a + mid, a + left);
+    }
+    sortCount(compare);
+    if (less(keyOf(a[right]), keyOf(a[left]))) {
+        sortCount(assign, 3);
+        std::iter_swap(a + right, a + left);
+    }
+    sortCount(compare);
+    if (less(keyOf(a[mid]), keyOf(a[right]))) {
+        sortCount(assign, 3);
+        std::iter_swap(a + mid, a + right);
+    }
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+void sortSiftDown(RandomIt a, int n, int hole, typename std::iterator_traits<RandomIt>::value_type x, KeyOf keyOf, Less less,
+                  Operation* compare, Operation* assign) {
+    while (2 * hole + 1 < n) {
+        int child = 2 * hole + 1;
+        if (child + 1 < n) {
+            sortCount(compare);
+            child += less(keyOf(a[child]), keyOf(a[child + 1]));
+        }
+        sortCount(compare);
+        if (!less(keyOf(x), keyOf(a[child]))) {
+            break;
+        }
+        sortCount(assign);
+        a[hole] = std::move(a[child]);
+        hole = child;
+    }
+    sortCount(assign);
+    a[hole] = std::move(x);
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+void sortHeapSort(RandomIt a, int n, KeyOf keyOf, Less less, Operation* compare, Operation* assign) {
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        sortCount(assign);
+        T x = std::move(a[i]);
+        sortSiftDown(a, n, i, std::move(x), keyOf, less, compare, assign);
+    }
+    for (int i = n - 1; i > 0; i--) {
+        sortCount(assign, 2);
+        T x = std::move(a[i]);
+        a[i] = std::move(a[0]);
+        sortSiftDown(a, i, 0, std::move(x), keyOf, less, compare, assign);
+    }
+}
+
+inline int sortDepthLimit(int n) {
+    int depth = 0;
+    while (n > 1) {
+        n >>= 1;
+        depth++;
+    }
+    return SORT_DEPTH_FACTOR * depth;
+}
+
+template <typename KeyOf, typename Less, typename FastPath>
+struct SortDefaultBaseCase {
+    KeyOf keyOf;
+    Less less;
+    Operation* compare;
+    Operation* assign;
+
+    template <typename RandomIt>
+    void operator()(RandomIt a, int n) const {
+        sortBaseCase(a, n, keyOf, less, compare, assign, FastPath());
+    }
+};
+
+template <typename RandomIt, typename KeyOf, typename Less, typename BaseCase>
+void hybridSortLoop(RandomIt first, RandomIt last, KeyOf keyOf, Less less, BaseCase baseCase, Operation* compare, Operation* assign,
+                    int threshold, int depthLimit) {
+    typedef SortFastPath<RandomIt, KeyOf, Less> fastPath;
+    int left = 0;
+    int right = (int)(last - first) - 1;
+
+    while (right - left + 1 > threshold) {
+        if (depthLimit-- == 0) {
+            sortHeapSort(first + left, right - left + 1, keyOf, less, compare, assign);
+            return;
+        }
+        medianOfThreeToEnd(first, left, right, keyOf, less, compare, assign);
+        int pivotIndex = sortPartition(first, left, right, keyOf, less, compare, assign, fastPath());
+        int equalStart = pivotIndex;
+        int size = right - left + 1;
+        if (pivotIndex - left > size - (size >> SORT_UNBALANCED_SHIFT)) {
+            equalStart = sortSplitEqual(first, left, pivotIndex, keyOf, less, compare, assign, fastPath());
+        }
+        if (equalStart - left < right - pivotIndex) {
+            hybridSortLoop(first + left, first + equalStart, keyOf, less, baseCase, compare, assign, threshold, depthLimit);
+            left = pivotIndex + 1;
+        } else {
+            hybridSortLoop(first + pivotIndex + 1, first + right + 1, keyOf, less, baseCase, compare, assign, threshold, depthLimit);
+            right = equalStart - 1;
+        }
+    }
+    if (right > left) {
+        baseCase(first + left, right - left + 1);
+    }
+}
+
+template <typename RandomIt, typename KeyOf, typename Less, typename BaseCase>
+void hybridSortWithBaseCase(RandomIt first, RandomIt last, KeyOf keyOf, Less less, BaseCase baseCase, Operation* compare = NULL,
+                            Operation* assign = NULL, int threshold = SORT_THRESHOLD) {
+    hybridSortLoop(first, last, keyOf, less, baseCase, compare, assign, threshold, sortDepthLimit((int)(last - first)));
+}
+
+template <typename RandomIt, typename KeyOf, typename Less>
+void hybridSort(RandomIt first, RandomIt last, KeyOf keyOf, Less less, Operation* compare = NULL, Operation* assign = NULL, int threshold = SORT_THRESHOLD) {
+    SortDefaultBaseCase<KeyOf, Less, SortFastPath<RandomIt, KeyOf, Less> > baseCase = {keyOf, less, compare, assign};
+    hybridSortWithBaseCase(first, last, keyOf, less, baseCase, compare, assign, threshold);
+}
+
+template <typename RandomIt, typename KeyOf>
+void hybridSort(RandomIt first, RandomIt last, KeyOf keyOf) {
+    hybridSort(first, last, keyOf, KeyLess());
+}
+
+template <typename RandomIt>
+void hybridSort(RandomIt first, RandomIt last) {
+    hybridSort(first, last, IdentityKey(), KeyLess());
+}
+
+template <typename K>
+unsigned int sortableKey(K key) {
+    static_assert(std::is_integral<K>::value && sizeof(K) <= 4, "key-index sorting needs an integer key of at most 32 bits");
+    if (std::is_signed<K>::value) {
+        return (unsigned int)(int)key ^ 0x80000000u;
+    }
+    return (unsigned int)key;
+}
+
+inline void radixSortKeyIndex(unsigned long long a[], int n, Operation* assign = NULL) {
+    if (n < 2) return;
+
+    int count[KEY_INDEX_RADIX_PASSES][KEY_INDEX_RADIX_BUCKETS] = {};
+    for (int i = 0; i < n; i++) {
+        unsigned int key = (unsigned int)(a[i] >> 32);
+        for (int pass = 0; pass < KEY_INDEX_RADIX_PASSES; pass++) {
+            count[pass][(key >> (pass * KEY_INDEX_RADIX_BITS)) & (KEY_INDEX_RADIX_BUCKETS - 1)]++;
+        }
+    }
+
+    unsigned long long* buffer = new unsigned long long[n];
+    unsigned long long* src = a;
+    unsigned long long* dest = buffer;
+    unsigned int firstKey = (unsigned int)(a[0] >> 32);
+
+    for (int pass = 0; pass < KEY_INDEX_RADIX_PASSES; pass++) {
+        int shift = 32 + pass * KEY_INDEX_RADIX_BITS;
+        if (count[pass][(firstKey >> (pass * KEY_INDEX_RADIX_BITS)) & (KEY_INDEX_RADIX_BUCKETS - 1)] == n) continue;
+
+        int offset[KEY_INDEX_RADIX_BUCKETS];
+        int sum = 0;
+        for (int d = 0; d < KEY_INDEX_RADIX_BUCKETS; d++) {
+            offset[d] = sum;
+            sum += count[pass][d];
+        }
+        sortCount(assign, n);
+        for (int i = 0; i < n; i++) {
+            dest[offset[(src[i] >> shift) & (KEY_INDEX_RADIX_BUCKETS - 1)]++] = src[i];
+        }
+
+        unsigned long long* t = src;
+        src = dest;
+        dest = t;
+    }
+
+    if (src != a) {
+        sortCount(assign, n);
+        memcpy(a, src, n * sizeof(unsigned long long));
+    }
+    delete[] buffer;
+}
+
+template <typename RandomIt, typename KeyOf>
+void sortPermutation(RandomIt first, RandomIt last, KeyOf keyOf, int perm[], Operation* assign = NULL) {
+    int n = (int)(last - first);
+    unsigned long long* keyIndex = new unsigned long long[n];
+    sortCount(assign, n);
+    for (int i = 0; i < n; i++) {
+        keyIndex[i] = ((unsigned long long)sortableKey(keyOf(first[i])) << 32) | (unsigned int)i;
+    }
+
+    radixSortKeyIndex(keyIndex, n, assign);
+
+    sortCount(assign, n);
+    for (int i = 0; i < n; i++) {
+        perm[i] = (int)(keyIndex[i] & 0xFFFFFFFFu);
+    }
+    delete[] keyIndex;
+}
+
+template <typename RandomIt>
+void applyPermutation(RandomIt first, const int perm[], int n, Operation* assign = NULL) {
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    T* buffer = new T[n];
+    sortCount(assign, 2 * n);
+    for (int i = 0; i < n; i++) {
+        buffer[i] = std::move(first[perm[i]]);
+    }
+    std::move(buffer, buffer + n, first);
+    delete[] buffer;
+}
+
+template <typename RandomIt, typename KeyOf>
+void indexSort(RandomIt first, RandomIt last, KeyOf keyOf, Operation* assign = NULL) {
+    int n = (int)(last - first);
+    int* perm = new int[n];
+    sortPermutation(first, last, keyOf, perm, assign);
+    applyPermutation(first, perm, n, assign);
+    delete[] perm;
+}
+
+
+struct StringKeyRef {
+    const char* text;
+    unsigned long long prefix;
+    unsigned long long nextPrefix;
+    int index;
+};
+
+inline unsigned long long stringPrefix(const char* s, int depth, int width) {
+    unsigned long long prefix = 0;
+    bool ended = false;
+    if (width != STRING_UNBOUNDED && width - depth >= STRING_PREFIX_BYTES) {
+        unsigned char bytes[STRING_PREFIX_BYTES];
+        memcpy(bytes, s + depth, STRING_PREFIX_BYTES);
+        for (int i = 0; i < STRING_PREFIX_BYTES; i++) {
+            ended |= bytes[i] == 0;
+            prefix = (prefix << 8) | (ended ? 0 : bytes[i]);
+        }
+        return prefix;
+    }
+    for (int i = 0; i < STRING_PREFIX_BYTES; i++) {
+        unsigned char c = 0;
+        if (!ended && depth + i < width) {
+            c = (unsigned char)s[depth + i];
+            ended = c == 0;
+        }
+        prefix = (prefix << 8) | c;
+    }
+    return prefix;
+}
+
+inline void stringRefAdvance(StringKeyRef& ref, int depth, int width) {
+    ref.prefix = depth == STRING_PREFIX_BYTES ? ref.nextPrefix : stringPrefix(ref.text, depth, width);
+}
+
+inline bool stringPrefixEnds(unsigned long long prefix, int depth, int width) {
+    return (prefix & 0xFF) == 0 || depth + STRING_PREFIX_BYTES >= width;
+}
+
+inline bool stringRefLess(const StringKeyRef& x, const StringKeyRef& y, int depth, int width) {
+    if (x.prefix != y.prefix) return x.prefix < y.prefix;
+    if (stringPrefixEnds(x.prefix, depth, width)) return false;
+    int rest = depth + STRING_PREFIX_BYTES;
+    return strncmp(x.text + rest, y.text + rest, (size_t)(width - rest)) < 0;
+}
+
+inline void stringInsertionSort(StringKeyRef a[], int n, int depth, int width, Operation* compare, Operation* assign) {
+    for (int i = 1; i < n; i++) {
+        StringKeyRef item = a[i];
+        int j = i - 1;
+        sortCount(compare);
+        while (j >= 0 && stringRefLess(item, a[j], depth, width)) {
+            sortCount(assign);
+            a[j + 1] = a[j];
+            j--;
+            if (j >= 0) sortCount(compare);
+        }
+        if (j + 1 != i) {
+            sortCount(assign);
+            a[j + 1] = item;
+        }
+    }
+}
+
+inline void multikeyQuickSort(StringKeyRef a[], int n, int depth, int width, Operation* compare = NULL, Operation* assign = NULL);
+
+inline void stringPrefixRadixSort(StringKeyRef a[], int n, int depth, int width, Operation* compare, Operation* assign) {
+    const int passes = STRING_PREFIX_BYTES;
+    int (*count)[KEY_INDEX_RADIX_BUCKETS] = new int[passes][KEY_INDEX_RADIX_BUCKETS]();
+    for (int i = 0; i < n; i++) {
+        unsigned long long prefix = a[i].prefix;
+        for (int pass = 0; pass < passes; pass++) {
+            count[pass][(prefix >> (pass * KEY_INDEX_RADIX_BITS)) & (KEY_INDEX_RADIX_BUCKETS - 1)]++;
+        }
+    }
+
+    StringKeyRef* buffer = new StringKeyRef[n];
+    StringKeyRef* src = a;
+    StringKeyRef* dest = buffer;
+    unsigned long long firstPrefix = a[0].prefix;
+    for (int pass = 0; pass < passes; pass++) {
+        int shift = pass * KEY_INDEX_RADIX_BITS;
+        if (count[pass][(firstPrefix >> shift) & (KEY_INDEX_RADIX_BUCKETS - 1)] == n) continue;
+
+        int offset[KEY_INDEX_RADIX_BUCKETS];
+        int sum = 0;
+        for (int d = 0; d < KEY_INDEX_RADIX_BUCKETS; d++) {
+            offset[d] = sum;
+            sum += count[pass][d];
+        }
+        sortCount(assign, n);
+        for (int i = 0; i < n; i++) {
+            dest[offset[(src[i].prefix >> shift) & (KEY_INDEX_RADIX_BUCKETS - 1)]++] = src[i];
+        }
+
+        StringKeyRef* t = src;
+        src = dest;
+        dest = t;
+    }
+    if (src != a) {
+        sortCount(assign, n);
+        std::copy(src, src + n, a);
+    }
+    delete[] buffer;
+    delete[] count;
+
+    int start = 0;
+    for (int i = 1; i <= n; i++) {
+        if (i < n) sortCount(compare);
+        if (i < n && a[i].prefix == a[start].prefix) continue;
+        if (i - start > 1 && !stringPrefixEnds(a[start].prefix, depth, width)) {
+            for (int j = start; j < i; j++) {
+                stringRefAdvance(a[j], depth + STRING_PREFIX_BYTES, width);
+            }
+            multikeyQuickSort(a + start, i - start, depth + STRING_PREFIX_BYTES, width, compare, assign);
+        }
+        start = i;
+    }
+}
+
+inline void multikeyQuickSort(StringKeyRef a[], int n, int depth, int width, Operation* compare, Operation* assign) {
+    if (n > STRING_RADIX_THRESHOLD) {
+        stringPrefixRadixSort(a, n, depth, width, compare, assign);
+        return;
+    }
+    while (n > STRING_SORT_THRESHOLD) {
+        unsigned long long x = a[0].prefix;
+        unsigned long long y = a[n / 2].prefix;
+        unsigned long long z = a[n - 1].prefix;
+        sortCount(compare, 3);
+        unsigned long long pivot = x < y ? (y < z ? y : (x < z ? z : x)) : (x < z ? x : (y < z ? z : y));
+
+        int lt = 0;
+        int i = 0;
+        int gt = n;
+        while (i < gt) {
+            sortCount(compare);
+            if (a[i].prefix < pivot) {
+                sortCount(assign, 3);
+                std::swap(a[lt++], a[i++]);
+            } else if (pivot < a[i].prefix) {
+                sortCount(assign, 3);
+                std::swap(a[i], a[--gt]);
+            } else {
+                i++;
+            }
+        }
+
+        multikeyQuickSort(a, lt, depth, width, compare, assign);
+        multikeyQuickSort(a + gt, n - gt, depth, width, compare, assign);
+        if (stringPrefixEnds(pivot, depth, width)) return;
+
+        a += lt;
+        n = gt - lt;
+        depth += STRING_PREFIX_BYTES;
+        for (int j = 0; j < n; j++) {
+            stringRefAdvance(a[j], depth, width);
+        }
+    }
+    stringInsertionSort(a, n, depth, width, compare, assign);
+}
+
+template <typename RandomIt, typename NameOf>
+void stringSortPermutation(RandomIt first, RandomIt last, NameOf nameOf, int width, int perm[], Operation* compare = NULL, Operation* assign = NULL) {
+    int n = (int)(last - first);
+    StringKeyRef* refs = new StringKeyRef[n];
+    sortCount(assign, n);
+    for (int i = 0; i < n; i++) {
+        refs[i].text = nameOf(first[i]);
+        refs[i].prefix = stringPrefix(refs[i].text, 0, width);
+        refs[i].nextPrefix = stringPrefixEnds(refs[i].prefix, 0, width) ? 0 : stringPrefix(refs[i].text, STRING_PREFIX_BYTES, width);
+        refs[i].index = i;
+    }
+
+    multikeyQuickSort(refs, n, 0, width, compare, assign);
+
+    sortCount(assign, n);
+    for (int i = 0; i < n; i++) {
+        perm[i] = refs[i].index;
+    }
+    delete[] refs;
+}
+
+template <typename RandomIt, typename NameOf>
+void stringIndexSort(RandomIt first, RandomIt last, NameOf nameOf, int width, Operation* compare = NULL, Operation* assign = NULL) {
+    int n = (int)(last - first);
+    int* perm = new int[n];
+    stringSortPermutation(first, last, nameOf, width, perm, compare, assign);
+    applyPermutation(first, perm, n, assign);
+    delete[] perm;
+}
+
+#endif
@@ -18,6 +18,16 @@
     Observatii:
     Eforturile cresc odata cu factorul de incarcare alpha, mai accentuat aproape de 1.0. Dupa stergeri, eforturile pentru cautari 
     cresc in continuare datorita elementelor sterse.
+
+    Afisarea ordonata: printSortedHashTable copiaza intrarile ocupate si le sorteaza dupa id cu indexSort din Sort.h (sortare indirecta pe
+    perechi (cheie, index) impachetate in 64 de biti, apoi o singura permutare a inregistrarilor). O intrare Entry are 36 de octeti, deci
+    mutarea ei la fiecare interschimbare ar domina sortarea. perfSort compara timpul sortarii directe a intrarilor (hybridSort), al sortarii
+    indirecte (indexSort) si al sortarii unui vector de int-uri de aceeasi dimensiune, ca referinta.
+
+    Afisarea dupa nume: printHashTableByName sorteaza intrarile dupa `name` cu stringIndexSort din Sort.h (multikey quicksort pe prefixe de
+    8 octeti cache-uite langa pointerul la nume, apoi o singura permutare a inregistrarilor). Comparatiile se fac pe cuvinte de 64 de biti,
+    iar sirurile sunt citite doar cand un grup de nume are aceleasi 8 caractere la adancimea curenta. perfSort masoara si sortarea dupa
+    nume, fata de hybridSort cu un comparator strncmp (fiecare comparatie citeste ambele siruri de la inceput).
 */
 
 #include <cstdio>
@@ -26,6 +36,7 @@
 #include <ctime>
 #include "Profiler.h"
 #include "TableProfiler.h"
+#include "Sort.h"
 
 #define C1 1
 #define C2 1
@@ -38,6 +49,8 @@
 #define MAX_INSERT_VAL 50000
 #define MIN_NOTFOUND_VAL ((MAX_INSERT_VAL) + (MIN_INSERT_VAL))
 #define MAX_NOTFOUND_VAL (2 * (MAX_INSERT_VAL))
+#define MAX_SORT_SIZE 1000000
+#define SORT_STEP_SIZE 100000
 
 typedef struct Entry {
     int id;
@@ -167,6 +180,54 @@ void printHashTable(Entry hashTable[], int table_size) {
     }
 }
 
+int entryId(const Entry& entry) {
+    return entry.id;
+}
+
+const char* entryName(const Entry& entry) {
+    return entry.name;
+}
+
+struct NameLess {
+    bool operator()(const char* x, const char* y) const {
+        return strncmp(x, y, sizeof(Entry::name)) < 0;
+    }
+};
+
+void printSortedHashTable(Entry hashTable[], int table_size) {
+    Entry* entries = new Entry[table_size];
+    int n = 0;
+    for (int i = 0; i < table_size; i++) {
+        if (hashTable[i].id != EMPTY_ID && hashTable[i].id != DELETED_ID) {
+            entries[n++] = hashTable[i];
+        }
+    }
+
+    indexSort(entries, entries + n, entryId);
+
+    for (int i = 0; i < n; i++) {
+        printf("(%d, '%s')\n", entries[i].id, entries[i].name);
+    }
+    delete[] entries;
+}
+
+void printHashTableByName(Entry hashTable[], int table_size) {
+    Entry* entries = new Entry[table_size];
+    int n = 0;
+    for (int i = 0; i < table_size; i++) {
+        if (hashTable[i].id != EMPTY_ID && hashTable[i].id != DELETED_ID) {
+            entries[n++] = hashTable[i];
+        }
+    }
+
+    stringIndexSort(entries, entries + n, entryName, (int)sizeof(entries[0].name));
+
+    for (int i = 0; i < n; i++) {
+        printf("(%d, '%s')\n", entries[i].id, entries[i].name);
+    }
+    delete[] entries;
+}
+
 void demo() {
     int a[] = {64, 34, 25, 12, 22, 11, 90};
     int n = sizeof(a)/sizeof(a[0]);
@@ -190,6 +251,12 @@ void demo() {
     printf("Contents:\n");
     printHashTable(hashTable, table_size);
 
+    printf("Contents sorted by id:\n");
+    printSortedHashTable(hashTable, table_size);
+
+    printf("Contents sorted by name:\n");
+    printHashTableByName(hashTable, table_size);
+
     int b[] = {34, 100, 12};
     int m = sizeof(b)/sizeof(b[0]);
     printf("Deleting entries:\n");
@@ -434,9 +501,68 @@ void perf_all() {
     closeReport(report);
 }
 
+void perfSort() {
+    Profiler p("Entry Sorting");
+    int* ids = new int[MAX_SORT_SIZE];
+    int* intArray = new int[MAX_SORT_SIZE];
+    Entry* entries = new Entry[MAX_SORT_SIZE];
+
+    for (int n = SORT_STEP_SIZE; n <= MAX_SORT_SIZE; n += SORT_STEP_SIZE) {
+        FillRandomArray(ids, n, MIN_INSERT_VAL, MAX_INSERT_VAL, false, UNSORTED);
+
+        for (int test = 0; test < NR_TESTS; test++) {
+            for (int j = 0; j < n; j++) {
+                entries[j].id = ids[j];
+                snprintf(entries[j].name, sizeof(entries[j].name), "Name%d", ids[j]);
+            }
+            p.startTimer("entry-direct-sort-time", n);
+            hybridSort(entries, entries + n, entryId);
+            p.stopTimer("entry-direct-sort-time", n);
+
+            for (int j = 0; j < n; j++) {
+                entries[j].id = ids[j];
+                snprintf(entries[j].name, sizeof(entries[j].name), "Name%d", ids[j]);
+            }
+            p.startTimer("entry-index-sort-time", n);
+            indexSort(entries, entries + n, entryId);
+            p.stopTimer("entry-index-sort-time", n);
+
+            for (int j = 0; j < n; j++) {
+                entries[j].id = ids[j];
+                snprintf(entries[j].name, sizeof(entries[j].name), "Name%d", ids[j]);
+            }
+            p.startTimer("entry-name-strcmp-sort-time", n);
+            hybridSort(entries, entries + n, entryName, NameLess());
+            p.stopTimer("entry-name-strcmp-sort-time", n);
+
+            for (int j = 0; j < n; j++) {
+                entries[j].id = ids[j];
+                snprintf(entries[j].name, sizeof(entries[j].name), "Name%d", ids[j]);
+            }
+            p.startTimer("entry-name-multikey-sort-time", n);
+            stringIndexSort(entries, entries + n, entryName, (int)sizeof(entries[0].name));
+            p.stopTimer("entry-name-multikey-sort-time", n);
+
+            CopyArray(intArray, ids, n);
+            p.startTimer("int-sort-time", n);
+            hybridSort(intArray, intArray + n);
+            p.stopTimer("int-sort-time", n);
+        }
+    }
+
+    delete[] ids;
+    delete[] intArray;
+    delete[] entries;
+
+    p.createGroup("Entry Sorting Times", "entry-direct-sort-time", "entry-index-sort-time", "int-sort-time");
+    p.createGroup("Entry Name Sorting Times", "entry-name-strcmp-sort-time", "entry-name-multikey-sort-time", "entry-index-sort-time");
+    p.showReport();
+}
+
 int main() {
     srand(time(nullptr));
     demo();
     // perf_all();
+    // perfSort();
     return 0;
 }
\ No newline at end of file
@@ -25,8 +25,9 @@
          Complexitate O(alpha(n)) amortizat.
 
     2. Algoritmi auxiliari:
-       - hybridQuickSort: Sorteaza muchiile crescator dupa cost. Combina QuickSort cu InsertionSort (pentru partitii < 15 elemente)
-         pentru eficienta practica.
+       - hybridSort (Sort.h): Sorteaza muchiile crescator dupa cost, folosind biblioteca generica de sortare comuna cu tema 3
+         (Hybrid QuickSort cu retele de sortare pentru partitii <= 16 elemente). Cheia este extrasa cu un lambda (e.weight), iar
+         comparatiile sunt generate inline la compilare, deci nu mai este nevoie de copii ale partition/insertionSort pentru Edge.
 
     3. kruskal(nodes, edges):
        - Initializeaza n multimi disjuncte.
@@ -47,6 +48,7 @@
 #include <cstdlib>
 #include <ctime>
 #include "Profiler.h"
+#include "Sort.h"
 
 #define MAX_N 10000
 
@@ -134,66 +136,9 @@ void printSets(Node* nodes[], int n) {
     }
 }
 
-int partition(Edge a[], int left, int right, Operation* opComp, Operation* opAssign) {
-    if (opAssign) opAssign->count();
-    Edge pivot = a[right];
-    int i = left - 1;
-    for (int j = left; j <= right - 1; j++) {
-        if (opComp) opComp->count();
-        if (a[j].weight < pivot.weight) {
-            i++;
-            if (opAssign) opAssign->count(3);
-            Edge temp = a[i];
-            a[i] = a[j];
-            a[j] = temp;
-        }
-    }
-    if (opAssign) opAssign->count(3);
-    Edge temp = a[i + 1];
-    a[i + 1] = a[right];
-    a[right] = temp;
-    return i + 1;
-}
-
-void insertionSort(Edge a[], int n, Operation* opComp, Operation* opAssign) {
-    for (int i = 1; i < n; i++) {
-        if (opAssign) opAssign->count();
-        Edge key = a[i];
-        int left = 0;
-        int right = i - 1;
-        while (left <= right) {
-            int mid = left + (right - left) / 2;
-            if (opComp) opComp->count();
-            if (a[mid].weight > key.weight) {
-                right = mid - 1;
-            } else {
-                left = mid + 1;
-            }
-        }
-        for (int j = i - 1; j >= left; j--) {
-            if (opAssign) opAssign->count();
-            a[j + 1] = a[j];
-        }
-        if (opAssign) opAssign->count();
-        a[left] = key;
-    }
-}
-
-void hybridQuickSort(Edge a[], int left, int right, int threshold, Operation* opComp, Operation* opAssign) {
-    if (left < right) {
-        if (right - left + 1 <= threshold) {
-            insertionSort(a + left, right - left + 1, opComp, opAssign);
-        } else {
-            int pivotIndex = partition(a, left, right, opComp, opAssign);
-            hybridQuickSort(a, left, pivotIndex - 1, threshold, opComp, opAssign);
-            hybridQuickSort(a, pivotIndex + 1, right, threshold, opComp, opAssign);
-        }
-    }
-}
-
 void kruskal(Node* nodes[], int n, Edge edges[], int m, bool print, Operation* opMake = NULL, Operation* opUnion = NULL, Operation* opFind = NULL) {
     for (int i = 0; i < n; i++) makeSet(nodes[i], i + 1, opMake);
-    hybridQuickSort(edges, 0, m - 1, 15, NULL, NULL);
+    hybridSort(edges, edges + m, [](const Edge& e) { return e.weight; });
 
     int mstWeight = 0;
     if (print) printf("Kruskal MST Selected Edges:\n");